@@ -50,6 +50,13 @@
 #include <nmmintrin.h>
 #endif
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#elif __ALTIVEC__
+#include <altivec.h>
+#undef bool
+#endif
+
 using namespace clang;
 
 //===----------------------------------------------------------------------===//
@@ -2612,6 +2619,24 @@ bool Lexer::SkipLineComment(Token &Result, const char *CurPtr,
 
   char C;
   while (true) {
+#ifdef __SSE2__
+    // Skip over 16 characters at a time while none of them is non-ASCII, a
+    // null or a newline.
+    while (BufferEnd - CurPtr >= 16) {
+      __m128i Chunk = _mm_loadu_si128((const __m128i *)CurPtr);
+      unsigned Mask =
+          _mm_movemask_epi8(Chunk) |
+          _mm_movemask_epi8(_mm_cmpeq_epi8(Chunk, _mm_setzero_si128())) |
+          _mm_movemask_epi8(_mm_cmpeq_epi8(Chunk, _mm_set1_epi8('\n'))) |
+          _mm_movemask_epi8(_mm_cmpeq_epi8(Chunk, _mm_set1_epi8('\r')));
+      unsigned Skip = Mask ? llvm::countr_zero(Mask) : 16;
+      if (Skip)
+        UnicodeDecodingAlreadyDiagnosed = false;
+      CurPtr += Skip;
+      if (Mask)
+        break;
+    }
+#endif
     C = *CurPtr;
     // Skip over characters in the fast loop.
     while (isASCII(C) && C != 0 &&   // Potentially EOF.
@@ -2850,13 +2875,6 @@ static bool isEndOfBlockCommentWithEscapedNewLine(const char *CurPtr, Lexer *L,
   return true;
 }
 
-#ifdef __SSE2__
-#include <emmintrin.h>
-#elif __ALTIVEC__
-#include <altivec.h>
-#undef bool
-#endif
-
 /// We have just read from input the / and * characters that started a comment.
 /// Read until we find the * and / characters that terminate the comment.
 /// Note that we don't bother decoding trigraphs or escaped newlines in block
@@ -98,7 +98,6 @@ static inline du_int udiv128by64to64(du_int u1, du_int u0, du_int v,
 // Returns: a / b
 
 COMPILER_RT_ABI tu_int __udivmodti4(tu_int a, tu_int b, tu_int *rem) {
-  const unsigned n_utword_bits = sizeof(tu_int) * CHAR_BIT;
   utwords dividend;
   dividend.all = a;
   utwords divisor;
@@ -130,28 +129,31 @@ COMPILER_RT_ABI tu_int __udivmodti4(tu_int a, tu_int b, tu_int *rem) {
       *rem = remainder.all;
     return quotient.all;
   }
+  // The divisor has a non-zero high word, so the quotient fits in 64 bits.
+  // Estimate it by dividing a / 2 by the top 64 bits of the normalized
+  // divisor and undoing the scaling. After decrementing, the estimate is the
+  // quotient or one less, which a single correction step fixes (Hacker's
+  // Delight, divlu2). Since a / 2 < 2^127 and the normalized divisor is at
+  // least 2^63, the 128-by-64 bit division cannot overflow.
   // 0 <= shift <= 63.
-  si_int shift =
-      __builtin_clzll(divisor.s.high) - __builtin_clzll(dividend.s.high);
-  divisor.all <<= shift;
-  quotient.s.high = 0;
-  quotient.s.low = 0;
-  for (; shift >= 0; --shift) {
-    quotient.s.low <<= 1;
-    // Branch free version of.
-    // if (dividend.all >= divisor.all)
-    // {
-    //    dividend.all -= divisor.all;
-    //    carry = 1;
-    // }
-    const ti_int s =
-        (ti_int)(divisor.all - dividend.all - 1) >> (n_utword_bits - 1);
-    quotient.s.low |= s & 1;
-    dividend.all -= divisor.all & s;
-    divisor.all >>= 1;
+  si_int shift = __builtin_clzll(divisor.s.high);
+  du_int v1 = (du_int)((divisor.all << shift) >> 64);
+  utwords u1;
+  u1.all = dividend.all >> 1;
+  du_int r;
+  du_int q = udiv128by64to64(u1.s.high, u1.s.low, v1, &r);
+  q >>= 63 - shift;
+  if (q != 0)
+    --q;
+  remainder.all = dividend.all - (tu_int)q * divisor.all;
+  if (remainder.all >= divisor.all) {
+    ++q;
+    remainder.all -= divisor.all;
   }
+  quotient.s.high = 0;
+  quotient.s.low = q;
   if (rem)
-    *rem = dividend.all;
+    *rem = remainder.all;
   return quotient.all;
 }
 
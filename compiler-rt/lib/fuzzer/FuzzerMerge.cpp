@@ -153,12 +153,17 @@ size_t Merger::Merge(const std::set<uint32_t> &InitialFeatures,
     AllFeatures.insert(Cur.begin(), Cur.end());
   }
   // Remove all features that we already know from all other inputs.
-  for (size_t i = NumFilesInFirstCorpus; i < Files.size(); i++) {
-    auto &Cur = Files[i].Features;
-    std::vector<uint32_t> Tmp;
-    std::set_difference(Cur.begin(), Cur.end(), AllFeatures.begin(),
-                        AllFeatures.end(), std::inserter(Tmp, Tmp.begin()));
-    Cur.swap(Tmp);
+  // Look up each feature instead of using std::set_difference, which would
+  // walk AllFeatures once per input.
+  if (!AllFeatures.empty()) {
+    for (size_t i = NumFilesInFirstCorpus; i < Files.size(); i++) {
+      auto &Cur = Files[i].Features;
+      Cur.erase(std::remove_if(Cur.begin(), Cur.end(),
+                               [&](uint32_t Fe) {
+                                 return AllFeatures.count(Fe) != 0;
+                               }),
+                Cur.end());
+    }
   }
 
   // Sort. Give preference to
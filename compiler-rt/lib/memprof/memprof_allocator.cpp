@@ -20,6 +20,7 @@
 #include "memprof_stack.h"
 #include "memprof_thread.h"
 #include "profile/MemProfData.inc"
+#include "sanitizer_common/sanitizer_allocation_sampler.h"
 #include "sanitizer_common/sanitizer_allocator_checks.h"
 #include "sanitizer_common/sanitizer_allocator_interface.h"
 #include "sanitizer_common/sanitizer_allocator_report.h"
@@ -107,6 +108,33 @@ static int GetTimestamp(void) {
   return (ts.tv_sec - memprof_init_timestamp_s) * 1000 + ts.tv_nsec / 1000000;
 }
 
+static THREADLOCAL AllocationSampler allocation_sampler;
+
+bool ShouldSampleAllocation(uptr size) {
+  int interval = flags()->sample_interval;
+  if (interval <= 0)
+    return true;
+  return allocation_sampler.ShouldSample(size, static_cast<u32>(interval));
+}
+
+// An allocation of `size` bytes is sampled with a probability of about
+// size / sample_interval. Scale the totals of its MemInfoBlock by the inverse
+// of that probability, so that the counts and bytes in a sampled profile
+// estimate those of all allocations. The minimums, maximums and averages are
+// unaffected.
+static void ScaleSampledMIB(MemInfoBlock &mib, u64 size) {
+  int interval = flags()->sample_interval;
+  if (interval <= 0 || size >= static_cast<u64>(interval))
+    return;
+  u64 weight = size ? (interval + size / 2) / size : interval;
+  mib.AllocCount *= weight;
+  mib.TotalAccessCount *= weight;
+  mib.TotalSize *= weight;
+  mib.TotalLifetime *= weight;
+  mib.TotalAccessDensity *= weight;
+  mib.TotalLifetimeAccessDensity *= weight;
+}
+
 static MemprofAllocator &get_allocator();
 
 // The memory chunk allocated from the underlying allocator looks like this:
@@ -312,11 +340,11 @@ struct Allocator {
 
   // See memprof_mapping.h for an overview on histogram counters.
   static MemInfoBlock CreateNewMIB(uptr p, MemprofChunk *m, u64 user_size) {
-    if (__memprof_histogram) {
-      return CreateNewMIBWithHistogram(p, m, user_size);
-    } else {
-      return CreateNewMIBWithoutHistogram(p, m, user_size);
-    }
+    MemInfoBlock newMIB = __memprof_histogram
+                              ? CreateNewMIBWithHistogram(p, m, user_size)
+                              : CreateNewMIBWithoutHistogram(p, m, user_size);
+    ScaleSampledMIB(newMIB, user_size);
+    return newMIB;
   }
 
   static MemInfoBlock CreateNewMIBWithHistogram(uptr p, MemprofChunk *m,
@@ -385,7 +413,7 @@ struct Allocator {
           Allocator *A = (Allocator *)alloc;
           MemprofChunk *m =
               A->GetMemprofChunk((void *)chunk, user_requested_size);
-          if (!m)
+          if (!m || !m->alloc_context_id)
             return;
           uptr user_beg = ((uptr)m) + kChunkHeaderSize;
           MemInfoBlock newMIB = CreateNewMIB(user_beg, m, user_requested_size);
@@ -474,14 +502,21 @@ struct Allocator {
     m->from_memalign = alloc_beg != chunk_beg;
     CHECK(size);
 
-    m->cpu_id = GetCpuId();
-    m->timestamp_ms = GetTimestamp();
-    m->alloc_context_id = StackDepotPut(*stack);
-
-    uptr size_rounded_down_to_granularity =
-        RoundDownTo(size, SHADOW_GRANULARITY);
-    if (size_rounded_down_to_granularity)
-      ClearShadow(user_beg, size_rounded_down_to_granularity);
+    // The interceptors leave the stack trace empty for an allocation that is
+    // not sampled. A zero context id marks such an allocation. Its shadow
+    // counts are never read, so there is no need to clear them either.
+    if (stack->size || flags()->sample_interval <= 0) {
+      m->cpu_id = GetCpuId();
+      m->timestamp_ms = GetTimestamp();
+      m->alloc_context_id = StackDepotPut(*stack);
+
+      uptr size_rounded_down_to_granularity =
+          RoundDownTo(size, SHADOW_GRANULARITY);
+      if (size_rounded_down_to_granularity)
+        ClearShadow(user_beg, size_rounded_down_to_granularity);
+    } else {
+      m->alloc_context_id = 0;
+    }
 
     MemprofStats &thread_stats = GetCurrentThreadStats();
     thread_stats.mallocs++;
@@ -515,7 +550,8 @@ struct Allocator {
 
     u64 user_requested_size =
         atomic_exchange(&m->user_requested_size, 0, memory_order_acquire);
-    if (memprof_inited && atomic_load_relaxed(&constructed) &&
+    if (m->alloc_context_id && memprof_inited &&
+        atomic_load_relaxed(&constructed) &&
         !atomic_load_relaxed(&destructing)) {
       MemInfoBlock newMIB = this->CreateNewMIB(p, m, user_requested_size);
       InsertOrMerge(m->alloc_context_id, newMIB, MIBMap);
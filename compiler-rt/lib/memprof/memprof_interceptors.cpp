@@ -219,7 +219,7 @@ INTERCEPTOR(char *, strdup, const char *s) {
   ENSURE_MEMPROF_INITED();
   uptr length = internal_strlen(s);
   MEMPROF_READ_RANGE(s, length + 1);
-  GET_STACK_TRACE_MALLOC;
+  GET_STACK_TRACE_MALLOC_SAMPLED(length + 1);
   void *new_mem = memprof_malloc(length + 1, &stack);
   REAL(memcpy)(new_mem, s, length + 1);
   return reinterpret_cast<char *>(new_mem);
@@ -233,7 +233,7 @@ INTERCEPTOR(char *, __strdup, const char *s) {
   ENSURE_MEMPROF_INITED();
   uptr length = internal_strlen(s);
   MEMPROF_READ_RANGE(s, length + 1);
-  GET_STACK_TRACE_MALLOC;
+  GET_STACK_TRACE_MALLOC_SAMPLED(length + 1);
   void *new_mem = memprof_malloc(length + 1, &stack);
   REAL(memcpy)(new_mem, s, length + 1);
   return reinterpret_cast<char *>(new_mem);
@@ -54,7 +54,7 @@ INTERCEPTOR(void *, malloc, uptr size) {
   if (DlsymAlloc::Use())
     return DlsymAlloc::Allocate(size);
   ENSURE_MEMPROF_INITED();
-  GET_STACK_TRACE_MALLOC;
+  GET_STACK_TRACE_MALLOC_SAMPLED(size);
   return memprof_malloc(size, &stack);
 }
 
@@ -62,7 +62,7 @@ INTERCEPTOR(void *, calloc, uptr nmemb, uptr size) {
   if (DlsymAlloc::Use())
     return DlsymAlloc::Callocate(nmemb, size);
   ENSURE_MEMPROF_INITED();
-  GET_STACK_TRACE_MALLOC;
+  GET_STACK_TRACE_MALLOC_SAMPLED(nmemb * size);
   return memprof_calloc(nmemb, size, &stack);
 }
 
@@ -70,33 +70,33 @@ INTERCEPTOR(void *, realloc, void *ptr, uptr size) {
   if (DlsymAlloc::Use() || DlsymAlloc::PointerIsMine(ptr))
     return DlsymAlloc::Realloc(ptr, size);
   ENSURE_MEMPROF_INITED();
-  GET_STACK_TRACE_MALLOC;
+  GET_STACK_TRACE_MALLOC_SAMPLED(size);
   return memprof_realloc(ptr, size, &stack);
 }
 
 #if SANITIZER_INTERCEPT_REALLOCARRAY
 INTERCEPTOR(void *, reallocarray, void *ptr, uptr nmemb, uptr size) {
   ENSURE_MEMPROF_INITED();
-  GET_STACK_TRACE_MALLOC;
+  GET_STACK_TRACE_MALLOC_SAMPLED(nmemb * size);
   return memprof_reallocarray(ptr, nmemb, size, &stack);
 }
 #endif // SANITIZER_INTERCEPT_REALLOCARRAY
 
 #if SANITIZER_INTERCEPT_MEMALIGN
 INTERCEPTOR(void *, memalign, uptr boundary, uptr size) {
-  GET_STACK_TRACE_MALLOC;
+  GET_STACK_TRACE_MALLOC_SAMPLED(size);
   return memprof_memalign(boundary, size, &stack, FROM_MALLOC);
 }
 
 INTERCEPTOR(void *, __libc_memalign, uptr boundary, uptr size) {
-  GET_STACK_TRACE_MALLOC;
+  GET_STACK_TRACE_MALLOC_SAMPLED(size);
   return memprof_memalign(boundary, size, &stack, FROM_MALLOC);
 }
 #endif // SANITIZER_INTERCEPT_MEMALIGN
 
 #if SANITIZER_INTERCEPT_ALIGNED_ALLOC
 INTERCEPTOR(void *, aligned_alloc, uptr boundary, uptr size) {
-  GET_STACK_TRACE_MALLOC;
+  GET_STACK_TRACE_MALLOC_SAMPLED(size);
   return memprof_aligned_alloc(boundary, size, &stack);
 }
 #endif // SANITIZER_INTERCEPT_ALIGNED_ALLOC
@@ -124,18 +124,18 @@ INTERCEPTOR(int, mallopt, int cmd, int value) { return 0; }
 #endif // SANITIZER_INTERCEPT_MALLOPT_AND_MALLINFO
 
 INTERCEPTOR(int, posix_memalign, void **memptr, uptr alignment, uptr size) {
-  GET_STACK_TRACE_MALLOC;
+  GET_STACK_TRACE_MALLOC_SAMPLED(size);
   return memprof_posix_memalign(memptr, alignment, size, &stack);
 }
 
 INTERCEPTOR(void *, valloc, uptr size) {
-  GET_STACK_TRACE_MALLOC;
+  GET_STACK_TRACE_MALLOC_SAMPLED(size);
   return memprof_valloc(size, &stack);
 }
 
 #if SANITIZER_INTERCEPT_PVALLOC
 INTERCEPTOR(void *, pvalloc, uptr size) {
-  GET_STACK_TRACE_MALLOC;
+  GET_STACK_TRACE_MALLOC_SAMPLED(size);
   return memprof_pvalloc(size, &stack);
 }
 #endif // SANITIZER_INTERCEPT_PVALLOC
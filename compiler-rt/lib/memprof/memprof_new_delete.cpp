@@ -31,13 +31,13 @@ enum class align_val_t : size_t {};
 } // namespace std
 
 #define OPERATOR_NEW_BODY(type, nothrow)                                       \
-  GET_STACK_TRACE_MALLOC;                                                      \
+  GET_STACK_TRACE_MALLOC_SAMPLED(size);                                       \
   void *res = memprof_memalign(0, size, &stack, type);                         \
   if (!nothrow && UNLIKELY(!res))                                              \
     ReportOutOfMemory(size, &stack);                                           \
   return res;
 #define OPERATOR_NEW_BODY_ALIGN(type, nothrow)                                 \
-  GET_STACK_TRACE_MALLOC;                                                      \
+  GET_STACK_TRACE_MALLOC_SAMPLED(size);                                       \
   void *res = memprof_memalign((uptr)align, size, &stack, type);               \
   if (!nothrow && UNLIKELY(!res))                                              \
     ReportOutOfMemory(size, &stack);                                           \
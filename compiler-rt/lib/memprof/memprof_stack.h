@@ -26,6 +26,11 @@ static const u32 kDefaultMallocContextSize = 30;
 void SetMallocContextSize(u32 size);
 u32 GetMallocContextSize();
 
+// Returns true if an allocation of `size` bytes should be profiled, which is
+// every allocation unless sample_interval is set. Defined in
+// memprof_allocator.cpp.
+bool ShouldSampleAllocation(uptr size);
+
 } // namespace __memprof
 
 // NOTE: A Rule of thumb is to retrieve stack trace in the interceptors
@@ -55,6 +60,14 @@ u32 GetMallocContextSize();
 #define GET_STACK_TRACE_MALLOC                                                 \
   GET_STACK_TRACE(GetMallocContextSize(), common_flags()->fast_unwind_on_malloc)
 
+// Like GET_STACK_TRACE_MALLOC, but for an allocation of `size` bytes that is
+// not sampled, the stack trace is left empty so that the allocation does not
+// pay for the unwind. The allocator does not profile such allocations.
+#define GET_STACK_TRACE_MALLOC_SAMPLED(size)                                   \
+  u32 malloc_context_size =                                                    \
+      ShouldSampleAllocation(size) ? GetMallocContextSize() : 0;               \
+  GET_STACK_TRACE(malloc_context_size, common_flags()->fast_unwind_on_malloc)
+
 #define GET_STACK_TRACE_FREE GET_STACK_TRACE_MALLOC
 
 #define PRINT_CURRENT_STACK()                                                  \
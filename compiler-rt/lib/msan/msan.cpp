@@ -39,6 +39,9 @@ using namespace __sanitizer;
 static THREADLOCAL int msan_expect_umr = 0;
 static THREADLOCAL int msan_expected_umr_found = 0;
 
+// Number of stores skipped since the last sampled chained origin.
+static THREADLOCAL int msan_chain_origin_skipped = 0;
+
 // Function argument shadow. Each argument starts at the next available 8-byte
 // aligned address.
 SANITIZER_INTERFACE_ATTRIBUTE
@@ -232,6 +235,7 @@ static void InitializeFlags() {
     Die();
   }
   if (f->store_context_size < 1) f->store_context_size = 1;
+  if (f->origin_chain_sample_rate < 1) f->origin_chain_sample_rate = 1;
 }
 
 void PrintWarningWithOrigin(uptr pc, uptr bp, u32 origin) {
@@ -625,6 +629,12 @@ void __msan_set_alloca_origin_no_descr(void *a, uptr size, u32 *id_ptr) {
 }
 
 u32 __msan_chain_origin(u32 id) {
+  int rate = flags()->origin_chain_sample_rate;
+  if (rate > 1) {
+    if (++msan_chain_origin_skipped < rate)
+      return id;
+    msan_chain_origin_skipped = 0;
+  }
   GET_CALLER_PC_BP;
   GET_STORE_STACK_TRACE_PC_BP(pc, bp);
   return ChainOrigin(id, &stack);
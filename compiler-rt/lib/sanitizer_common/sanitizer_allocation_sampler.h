@@ -0,0 +1,51 @@
+//===-- sanitizer_allocation_sampler.h --------------------------*- C++ -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// Byte-based allocation sampling, shared by the allocator-based tools.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef SANITIZER_ALLOCATION_SAMPLER_H
+#define SANITIZER_ALLOCATION_SAMPLER_H
+
+#include "sanitizer_allocator.h"
+#include "sanitizer_common.h"
+
+namespace __sanitizer {
+
+// Picks the allocations to sample so that on average one allocation is sampled
+// per `interval` bytes allocated. The distance to the next sampled allocation
+// is drawn uniformly from [1, 2 * interval], so larger allocations are
+// proportionally more likely to be sampled. Keep one instance per thread; a
+// zero-initialized instance (e.g. a THREADLOCAL one) is ready to use.
+class AllocationSampler {
+ public:
+  // Returns true if an allocation of `size` bytes should be sampled. An
+  // `interval` of zero samples every allocation.
+  bool ShouldSample(uptr size, u32 interval) {
+    if (!interval)
+      return true;
+    if (bytes_until_sample_ > size) {
+      bytes_until_sample_ -= size;
+      return false;
+    }
+    DCHECK_LT(interval, 1U << 31);
+    if (!rand_state_)
+      rand_state_ = static_cast<u32>(NanoTime()) | 1;
+    bytes_until_sample_ = 1 + RandN(&rand_state_, 2 * interval);
+    return true;
+  }
+
+ private:
+  uptr bytes_until_sample_;
+  u32 rand_state_;
+};
+
+}  // namespace __sanitizer
+
+#endif  // SANITIZER_ALLOCATION_SAMPLER_H
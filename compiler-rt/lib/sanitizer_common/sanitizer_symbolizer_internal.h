@@ -13,6 +13,7 @@
 #ifndef SANITIZER_SYMBOLIZER_INTERNAL_H
 #define SANITIZER_SYMBOLIZER_INTERNAL_H
 
+#include "sanitizer_dense_map.h"
 #include "sanitizer_file.h"
 #include "sanitizer_symbolizer.h"
 #include "sanitizer_vector.h"
@@ -137,11 +138,25 @@ class LLVMSymbolizer final : public SymbolizerTool {
   bool SymbolizeFrame(uptr addr, FrameInfo *info) override;
 
  private:
+  bool FormatCommand(const char *command_prefix, const char *module_name,
+                     uptr module_offset, ModuleArch arch);
   const char *FormatAndSendCommand(const char *command_prefix,
                                    const char *module_name, uptr module_offset,
                                    ModuleArch arch);
+  const char *SendCachedCodeCommand(uptr module_offset);
+
+  // Responses to "CODE" commands, so that PCs which appear in many reported
+  // stacks (e.g. in leak reports) are only sent to the symbolizer once.
+  // Entries are chained by module offset and matched on the full command.
+  struct CachedResponse {
+    const char *command;
+    const char *response;
+    CachedResponse *next;
+  };
+  DenseMap<uptr, CachedResponse *> code_cache_;
 
   LLVMSymbolizerProcess *symbolizer_process_;
+  LowLevelAllocator *allocator_;
   static const uptr kBufferSize = 16 * 1024;
   char buffer_[kBufferSize];
 };
@@ -12,6 +12,7 @@
 
 #include "sanitizer_allocator_internal.h"
 #include "sanitizer_internal_defs.h"
+#include "sanitizer_placement_new.h"
 #include "sanitizer_platform.h"
 #include "sanitizer_symbolizer_internal.h"
 
@@ -305,7 +306,8 @@ class LLVMSymbolizerProcess final : public SymbolizerProcess {
 };
 
 LLVMSymbolizer::LLVMSymbolizer(const char *path, LowLevelAllocator *allocator)
-    : symbolizer_process_(new(*allocator) LLVMSymbolizerProcess(path)) {}
+    : symbolizer_process_(new(*allocator) LLVMSymbolizerProcess(path)),
+      allocator_(allocator) {}
 
 // Parse a <file>:<line>[:<column>] buffer. The file path may contain colons on
 // Windows, so extract tokens from the right hand side first. The column info is
@@ -427,8 +429,10 @@ void ParseSymbolizeFrameOutput(const char *str,
 
 bool LLVMSymbolizer::SymbolizePC(uptr addr, SymbolizedStack *stack) {
   AddressInfo *info = &stack->info;
-  const char *buf = FormatAndSendCommand(
-      "CODE", info->module, info->module_offset, info->module_arch);
+  if (!FormatCommand("CODE", info->module, info->module_offset,
+                     info->module_arch))
+    return false;
+  const char *buf = SendCachedCodeCommand(info->module_offset);
   if (!buf)
     return false;
   ParseSymbolizePCOutput(buf, stack);
@@ -454,10 +458,9 @@ bool LLVMSymbolizer::SymbolizeFrame(uptr addr, FrameInfo *info) {
   return true;
 }
 
-const char *LLVMSymbolizer::FormatAndSendCommand(const char *command_prefix,
-                                                 const char *module_name,
-                                                 uptr module_offset,
-                                                 ModuleArch arch) {
+bool LLVMSymbolizer::FormatCommand(const char *command_prefix,
+                                   const char *module_name, uptr module_offset,
+                                   ModuleArch arch) {
   CHECK(module_name);
   int size_needed = 0;
   if (arch == kModuleArchUnknown)
@@ -470,12 +473,46 @@ const char *LLVMSymbolizer::FormatAndSendCommand(const char *command_prefix,
 
   if (size_needed >= static_cast<int>(kBufferSize)) {
     Report("WARNING: Command buffer too small");
-    return nullptr;
+    return false;
   }
+  return true;
+}
 
+const char *LLVMSymbolizer::FormatAndSendCommand(const char *command_prefix,
+                                                 const char *module_name,
+                                                 uptr module_offset,
+                                                 ModuleArch arch) {
+  if (!FormatCommand(command_prefix, module_name, module_offset, arch))
+    return nullptr;
   return symbolizer_process_->SendCommand(buffer_);
 }
 
+static char *CopyString(LowLevelAllocator *allocator, const char *str) {
+  uptr size = internal_strlen(str) + 1;
+  char *res = static_cast<char *>(allocator->Allocate(size));
+  internal_memcpy(res, str, size);
+  return res;
+}
+
+// Sends the command in buffer_, unless an earlier identical command has been
+// answered already.
+const char *LLVMSymbolizer::SendCachedCodeCommand(uptr module_offset) {
+  CachedResponse *&head = code_cache_[module_offset];
+  for (CachedResponse *entry = head; entry; entry = entry->next)
+    if (!internal_strcmp(entry->command, buffer_))
+      return entry->response;
+
+  const char *res = symbolizer_process_->SendCommand(buffer_);
+  if (!res)
+    return nullptr;
+  CachedResponse *entry = new (*allocator_) CachedResponse;
+  entry->command = CopyString(allocator_, buffer_);
+  entry->response = CopyString(allocator_, res);
+  entry->next = head;
+  head = entry;
+  return entry->response;
+}
+
 SymbolizerProcess::SymbolizerProcess(const char *path, bool use_posix_spawn)
     : path_(path),
       input_fd_(kInvalidFd),
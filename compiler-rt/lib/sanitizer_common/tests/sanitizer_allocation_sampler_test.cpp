@@ -0,0 +1,44 @@
+//===-- sanitizer_allocation_sampler_test.cpp -----------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file is a part of *Sanitizer runtime.
+//
+//===----------------------------------------------------------------------===//
+#include "sanitizer_common/sanitizer_allocation_sampler.h"
+
+#include "gtest/gtest.h"
+
+namespace __sanitizer {
+
+TEST(AllocationSampler, ZeroIntervalSamplesEverything) {
+  AllocationSampler sampler = {};
+  for (uptr i = 0; i < 1000; i++) EXPECT_TRUE(sampler.ShouldSample(i, 0));
+}
+
+TEST(AllocationSampler, SamplesByBytes) {
+  AllocationSampler sampler = {};
+  const u32 kInterval = 1000;
+  const uptr kSize = 16;
+  const uptr kAllocs = 1000000;
+  uptr sampled = 0;
+  for (uptr i = 0; i < kAllocs; i++)
+    sampled += sampler.ShouldSample(kSize, kInterval);
+  // On average one sample per kInterval + 1/2 bytes.
+  const uptr expected = kAllocs * kSize / kInterval;
+  EXPECT_GT(sampled, expected * 9 / 10);
+  EXPECT_LT(sampled, expected * 11 / 10);
+}
+
+TEST(AllocationSampler, LargeAllocationsAreAlwaysSampled) {
+  AllocationSampler sampler = {};
+  const u32 kInterval = 1000;
+  for (uptr i = 0; i < 1000; i++)
+    EXPECT_TRUE(sampler.ShouldSample(2 * kInterval + 1, kInterval));
+}
+
+}  // namespace __sanitizer
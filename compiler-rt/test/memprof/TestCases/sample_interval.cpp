@@ -0,0 +1,32 @@
+// Check that with sample_interval, allocations are sampled by bytes allocated
+// and the counts of the sampled allocations are scaled back up.
+
+// RUN: %clangxx_memprof -O0 %s -o %t
+// RUN: %env_memprof_opts=print_text=true:log_path=stderr %run %t 2>&1 | FileCheck %s --check-prefix=ALL
+// RUN: %env_memprof_opts=print_text=true:log_path=stderr:sample_interval=1024 %run %t 2>&1 | FileCheck %s --check-prefix=SAMPLED
+
+#include <stdlib.h>
+
+int main() {
+  // An allocation of at least twice the interval is always sampled, and is
+  // recorded as a single allocation.
+  char *large = (char *)malloc(4096);
+  large[0] = 0;
+  free(large);
+
+  // About one in 128 of these is sampled, and each sample stands for about
+  // 128 allocations.
+  for (int i = 0; i < 10000; ++i) {
+    char *small = (char *)malloc(8);
+    small[0] = 0;
+    free(small);
+  }
+  return 0;
+}
+
+// ALL-DAG: alloc_count 1, size (ave/min/max) 4096.00 / 4096 / 4096
+// ALL-DAG: alloc_count 10000, size (ave/min/max) 8.00 / 8 / 8
+
+// SAMPLED-DAG: alloc_count 1, size (ave/min/max) 4096.00 / 4096 / 4096
+// SAMPLED-DAG: alloc_count {{[1-9][0-9]{3,4}}}, size (ave/min/max) 8.00 / 8 / 8
+// SAMPLED-NOT: alloc_count 10000, size
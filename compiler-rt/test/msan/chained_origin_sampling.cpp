@@ -0,0 +1,34 @@
+// RUN: %clangxx_msan -fsanitize-memory-track-origins=2 -O3 %s -o %t
+
+// RUN: env MSAN_OPTIONS=origin_chain_sample_rate=2 not %run %t >%t.out 2>&1
+// RUN: FileCheck %s --check-prefix=CHECK --check-prefix=CHECK2 < %t.out
+
+// RUN: env MSAN_OPTIONS=origin_chain_sample_rate=100 not %run %t >%t.out 2>&1
+// RUN: FileCheck %s --check-prefix=CHECK --check-prefix=CHECK100 < %t.out
+
+#include <stdio.h>
+
+volatile int x, y;
+
+__attribute__((noinline)) void fn_g(int &a) { x = a; }
+
+__attribute__((noinline)) void fn_h() { y = x; }
+
+int main(int argc, char *argv[]) {
+  int volatile z;
+  fn_g((int &)z);
+  fn_h();
+  return y;
+}
+
+// CHECK: WARNING: MemorySanitizer: use-of-uninitialized-value
+// CHECK: {{#0 .* in main.*chained_origin_sampling.cpp:}}[[@LINE-4]]
+
+// Only the second of the two uninitialized stores is sampled.
+// CHECK2: Uninitialized value was stored to memory at
+// CHECK2: {{#0 .* in fn_h.*chained_origin_sampling.cpp:}}[[@LINE-14]]
+// CHECK2-NOT: Uninitialized value was stored to memory at
+
+// CHECK100-NOT: Uninitialized value was stored to memory at
+
+// CHECK: Uninitialized value was created by an allocation of 'z' in the stack frame
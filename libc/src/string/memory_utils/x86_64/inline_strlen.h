@@ -0,0 +1,106 @@
+//===-- SSE2 implementation of strlen, memchr and strchr ------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// These functions read whole aligned 16-byte blocks, so they may read past the
+// end of the string but never cross into the next page. They are only used
+// with LIBC_COPT_STRING_UNSAFE_WIDE_READ, like the word-at-a-time versions in
+// string_utils.h.
+//
+//===----------------------------------------------------------------------===//
+#ifndef LLVM_LIBC_SRC_STRING_MEMORY_UTILS_X86_64_INLINE_STRLEN_H
+#define LLVM_LIBC_SRC_STRING_MEMORY_UTILS_X86_64_INLINE_STRLEN_H
+
+#include "src/__support/CPP/bit.h"             // countr_zero
+#include "src/__support/macros/attributes.h" // LIBC_INLINE
+#include "src/__support/macros/config.h"     // LIBC_NAMESPACE_DECL
+
+#include <immintrin.h>
+#include <stddef.h> // size_t
+#include <stdint.h> // uintptr_t
+
+namespace LIBC_NAMESPACE_DECL {
+namespace internal::x86 {
+
+LIBC_INLINE constexpr size_t SSE2_BLOCK_SIZE = sizeof(__m128i);
+
+// Returns the aligned block containing `src` and the offset of `src` in it.
+LIBC_INLINE const __m128i *align_to_block(const void *src, size_t &offset) {
+  uintptr_t addr = reinterpret_cast<uintptr_t>(src);
+  offset = addr % SSE2_BLOCK_SIZE;
+  return reinterpret_cast<const __m128i *>(addr - offset);
+}
+
+// Returns a bit mask of the bytes of `block` that equal the bytes of `needle`.
+LIBC_INLINE uint32_t match_block(const __m128i *block, __m128i needle) {
+  return static_cast<uint32_t>(
+      _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128(block), needle)));
+}
+
+LIBC_INLINE size_t string_length_sse2(const char *src) {
+  const __m128i zero = _mm_setzero_si128();
+  size_t offset;
+  const __m128i *block = align_to_block(src, offset);
+  // Ignore the bytes of the first block that precede the string.
+  uint32_t mask = match_block(block, zero) >> offset;
+  if (mask)
+    return cpp::countr_zero(mask);
+  for (;;) {
+    mask = match_block(++block, zero);
+    if (mask)
+      return static_cast<size_t>(reinterpret_cast<const char *>(block) - src) +
+             cpp::countr_zero(mask);
+  }
+}
+
+LIBC_INLINE void *find_first_character_sse2(const unsigned char *src,
+                                            unsigned char ch, size_t n) {
+  const __m128i needle = _mm_set1_epi8(static_cast<char>(ch));
+  size_t offset;
+  const __m128i *block = align_to_block(src, offset);
+  uint32_t mask = match_block(block, needle) >> offset;
+  // Position in `src` that bit 0 of `mask` corresponds to.
+  const unsigned char *base = src;
+  for (;;) {
+    if (mask) {
+      size_t index = static_cast<size_t>(base - src) + cpp::countr_zero(mask);
+      return index < n ? const_cast<unsigned char *>(src + index) : nullptr;
+    }
+    base = reinterpret_cast<const unsigned char *>(++block);
+    if (static_cast<size_t>(base - src) >= n)
+      return nullptr;
+    mask = match_block(block, needle);
+  }
+}
+
+// Returns a pointer to the first byte of `src` that is either `ch` or the null
+// terminator.
+LIBC_INLINE char *find_first_character_or_nul_sse2(const char *src, char ch) {
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i needle = _mm_set1_epi8(ch);
+  auto match = [&](const __m128i *block) {
+    __m128i value = _mm_load_si128(block);
+    return static_cast<uint32_t>(_mm_movemask_epi8(_mm_or_si128(
+        _mm_cmpeq_epi8(value, zero), _mm_cmpeq_epi8(value, needle))));
+  };
+  size_t offset;
+  const __m128i *block = align_to_block(src, offset);
+  uint32_t mask = match(block) >> offset;
+  if (mask)
+    return const_cast<char *>(src) + cpp::countr_zero(mask);
+  for (;;) {
+    mask = match(++block);
+    if (mask)
+      return const_cast<char *>(reinterpret_cast<const char *>(block)) +
+             cpp::countr_zero(mask);
+  }
+}
+
+} // namespace internal::x86
+} // namespace LIBC_NAMESPACE_DECL
+
+#endif // LLVM_LIBC_SRC_STRING_MEMORY_UTILS_X86_64_INLINE_STRLEN_H
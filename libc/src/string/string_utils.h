@@ -20,6 +20,13 @@
 #include "src/__support/CPP/type_traits.h" // cpp::is_same_v
 #include "src/__support/macros/config.h"
 #include "src/__support/macros/optimization.h" // LIBC_UNLIKELY
+#include "src/__support/macros/properties/architectures.h"
+
+#if defined(LIBC_COPT_STRING_UNSAFE_WIDE_READ) &&                              \
+    defined(LIBC_TARGET_ARCH_IS_X86) && defined(__SSE2__)
+#include "src/string/memory_utils/x86_64/inline_strlen.h"
+#define LIBC_STRING_UTILS_USE_SSE2
+#endif
 
 namespace LIBC_NAMESPACE_DECL {
 namespace internal {
@@ -88,8 +95,13 @@ template <typename T> LIBC_INLINE size_t string_length(const T *src) {
   // performs better than larger sizes when the src pointer can't be assumed to
   // be aligned to a word boundary, so it's the size we use for reading the
   // string a block at a time.
-  if constexpr (cpp::is_same_v<T, char>)
+  if constexpr (cpp::is_same_v<T, char>) {
+#ifdef LIBC_STRING_UTILS_USE_SSE2
+    return x86::string_length_sse2(src);
+#else
     return string_length_wide_read<unsigned int>(src);
+#endif
+  }
 #endif
   size_t length;
   for (length = 0; *src; ++src, ++length)
@@ -151,7 +163,11 @@ LIBC_INLINE void *find_first_character(const unsigned char *src,
   // Unsigned int is used for the same reason as in strlen.
   using BlockType = unsigned int;
   if (max_strlen > (sizeof(BlockType) * 4)) {
+#ifdef LIBC_STRING_UTILS_USE_SSE2
+    return x86::find_first_character_sse2(src, ch, max_strlen);
+#else
     return find_first_character_wide_read<BlockType>(src, ch, max_strlen);
+#endif
   }
 #endif
   return find_first_character_byte_read(src, ch, max_strlen);
@@ -227,8 +243,12 @@ template <bool ReturnNull = true>
 LIBC_INLINE constexpr static char *strchr_implementation(const char *src,
                                                          int c) {
   char ch = static_cast<char>(c);
+#ifdef LIBC_STRING_UTILS_USE_SSE2
+  src = x86::find_first_character_or_nul_sse2(src, ch);
+#else
   for (; *src && *src != ch; ++src)
     ;
+#endif
   char *ret = ReturnNull ? nullptr : const_cast<char *>(src);
   return *src == ch ? const_cast<char *>(src) : ret;
 }
@@ -249,4 +269,6 @@ LIBC_INLINE constexpr static char *strrchr_implementation(const char *src,
 } // namespace internal
 } // namespace LIBC_NAMESPACE_DECL
 
+#undef LIBC_STRING_UTILS_USE_SSE2
+
 #endif //  LLVM_LIBC_SRC_STRING_STRING_UTILS_H
@@ -84,6 +84,26 @@ template <auto Func> struct StrchrTest : public LIBC_NAMESPACE::testing::Test {
     ASSERT_EQ(Func("", '3'), nullptr);
     ASSERT_EQ(Func("", '*'), nullptr);
   }
+
+  void allAlignmentsAndLengths() {
+    // Cover every offset of the string within a 16-byte block, matches before,
+    // at and after the null terminator, and strings spanning several blocks.
+    char buffer[128];
+    for (size_t offset = 0; offset < 16; ++offset) {
+      for (size_t length = 0; length < 48; ++length) {
+        for (size_t pos = 0; pos < 48; ++pos) {
+          for (size_t i = 0; i < sizeof(buffer); ++i)
+            buffer[i] = 'a';
+          char *src = buffer + offset;
+          src[pos] = 'b';
+          src[length] = '\0';
+          char *expected = pos < length ? src + pos : nullptr;
+          ASSERT_EQ(Func(src, 'b'), expected);
+          ASSERT_EQ(Func(src, '\0'), src + length);
+        }
+      }
+    }
+  }
 };
 
 template <auto Func> struct StrrchrTest : public LIBC_NAMESPACE::testing::Test {
@@ -183,6 +203,9 @@ template <auto Func> struct StrrchrTest : public LIBC_NAMESPACE::testing::Test {
   }                                                                            \
   TEST_F(LlvmLibc##name##Test, EmptyStringShouldOnlyMatchNullTerminator) {     \
     emptyStringShouldOnlyMatchNullTerminator();                                \
+  }                                                                            \
+  TEST_F(LlvmLibc##name##Test, AllAlignmentsAndLengths) {                      \
+    allAlignmentsAndLengths();                                                 \
   }
 
 #define STRRCHR_TEST(name, func)                                               \
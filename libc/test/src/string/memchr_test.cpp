@@ -122,6 +122,25 @@ TEST(LlvmLibcMemChrTest, SignedCharacterFound) {
   ASSERT_EQ(actual[0], c);
 }
 
+TEST(LlvmLibcMemChrTest, AllAlignmentsAndSizes) {
+  // Cover every offset of the source within a 16-byte block, matches before,
+  // at and after the end of the searched range, and ranges spanning several
+  // blocks.
+  char buffer[128];
+  for (size_t offset = 0; offset < 16; ++offset) {
+    for (size_t pos = 0; pos < 64; ++pos) {
+      for (size_t i = 0; i < sizeof(buffer); ++i)
+        buffer[i] = 'a';
+      buffer[offset + pos] = 'b';
+      const char *src = buffer + offset;
+      for (size_t size = 0; size < 64; ++size) {
+        const char *expected = pos < size ? src + pos : nullptr;
+        ASSERT_EQ(call_memchr(src, 'b', size), expected);
+      }
+    }
+  }
+}
+
 #if defined(LIBC_ADD_NULL_CHECKS) && !defined(LIBC_HAS_SANITIZER)
 
 TEST(LlvmLibcMemChrTest, CrashOnNullPtr) {
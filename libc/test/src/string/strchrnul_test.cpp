@@ -94,3 +94,22 @@ TEST(LlvmLibcStrChrNulTest, EmptyStringShouldOnlyMatchNullTerminator) {
   result = LIBC_NAMESPACE::strchrnul("", '*');
   ASSERT_EQ(*result, '\0');
 }
+
+TEST(LlvmLibcStrChrNulTest, AllAlignmentsAndLengths) {
+  // Cover every offset of the string within a 16-byte block, matches before,
+  // at and after the null terminator, and strings spanning several blocks.
+  char buffer[128];
+  for (size_t offset = 0; offset < 16; ++offset) {
+    for (size_t length = 0; length < 48; ++length) {
+      for (size_t pos = 0; pos < 48; ++pos) {
+        for (size_t i = 0; i < sizeof(buffer); ++i)
+          buffer[i] = 'a';
+        char *src = buffer + offset;
+        src[pos] = 'b';
+        src[length] = '\0';
+        char *expected = pos < length ? src + pos : src + length;
+        ASSERT_EQ(LIBC_NAMESPACE::strchrnul(src, 'b'), expected);
+      }
+    }
+  }
+}
@@ -22,3 +22,17 @@ TEST(LlvmLibcStrLenTest, AnyString) {
   size_t result = LIBC_NAMESPACE::strlen(any);
   ASSERT_EQ((size_t)12, result);
 }
+
+TEST(LlvmLibcStrLenTest, AllAlignmentsAndLengths) {
+  // Cover every offset of the string within a 16-byte block, and strings
+  // spanning several blocks.
+  char buffer[128];
+  for (size_t offset = 0; offset < 16; ++offset) {
+    for (size_t length = 0; length < 64; ++length) {
+      for (size_t i = 0; i < sizeof(buffer); ++i)
+        buffer[i] = 'a';
+      buffer[offset + length] = '\0';
+      ASSERT_EQ(length, LIBC_NAMESPACE::strlen(buffer + offset));
+    }
+  }
+}
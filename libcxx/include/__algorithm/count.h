@@ -12,14 +12,22 @@
 
 #include <__algorithm/iterator_operations.h>
 #include <__algorithm/min.h>
+#include <__algorithm/simd_utils.h>
+#include <__algorithm/unwrap_iter.h>
 #include <__bit/invert_if.h>
 #include <__bit/popcount.h>
 #include <__config>
+#include <__cstddef/ptrdiff_t.h>
+#include <__cstddef/size_t.h>
 #include <__functional/identity.h>
 #include <__fwd/bit_reference.h>
 #include <__iterator/iterator_traits.h>
 #include <__type_traits/enable_if.h>
 #include <__type_traits/invoke.h>
+#include <__type_traits/is_constant_evaluated.h>
+#include <__type_traits/is_integral.h>
+#include <__type_traits/is_same.h>
+#include <__type_traits/remove_cv.h>
 
 #if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
 #  pragma GCC system_header
@@ -41,6 +49,58 @@ __count(_Iter __first, _Sent __last, const _Tp& __value, _Proj& __proj) {
   return __r;
 }
 
+#if _LIBCPP_VECTORIZE_ALGORITHMS
+
+template <class _Tp>
+[[__nodiscard__]] _LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_SINCE_CXX20 ptrdiff_t
+__count_vectorized(_Tp* __first, _Tp* __last, __remove_cv_t<_Tp> __value) {
+  using __value_type              = __remove_cv_t<_Tp>;
+  constexpr size_t __unroll_count = 4;
+  constexpr size_t __vec_size     = __native_vector_size<__value_type>;
+  using __vec                     = __simd_vector<__value_type, __vec_size>;
+
+  ptrdiff_t __r = 0;
+  if (!__libcpp_is_constant_evaluated()) {
+    __vec __values = __value;
+
+    // Every lane of a comparison result is either 0 or -1, so the sum of __unroll_count results still fits into a
+    // single lane, and the horizontal sum of that fits into the lane type as well, since a native vector is at most
+    // 32 bytes wide.
+    while (static_cast<size_t>(__last - __first) >= __unroll_count * __vec_size) {
+      auto __cmp_res = std::__load_vector<__vec>(__first) == __values;
+      for (size_t __i = 1; __i != __unroll_count; ++__i)
+        __cmp_res += std::__load_vector<__vec>(__first + __i * __vec_size) == __values;
+      __r -= __builtin_reduce_add(__cmp_res);
+      __first += __unroll_count * __vec_size;
+    }
+
+    // check the remaining 0-3 vectors
+    while (static_cast<size_t>(__last - __first) >= __vec_size) {
+      __r -= __builtin_reduce_add(std::__load_vector<__vec>(__first) == __values);
+      __first += __vec_size;
+    }
+  }
+
+  for (; __first != __last; ++__first)
+    if (*__first == __value)
+      ++__r;
+  return __r;
+}
+
+template <class,
+          class _Up,
+          class _Tp,
+          class _Proj,
+          __enable_if_t<__is_identity<_Proj>::value && is_integral<_Tp>::value && !is_same<_Tp, bool>::value &&
+                            is_same<__remove_cv_t<_Up>, _Tp>::value,
+                        int> = 0>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_SINCE_CXX20 ptrdiff_t
+__count(_Up* __first, _Up* __last, const _Tp& __value, _Proj&) {
+  return std::__count_vectorized(__first, __last, __value);
+}
+
+#endif // _LIBCPP_VECTORIZE_ALGORITHMS
+
 // __bit_iterator implementation
 template <bool _ToCount, class _Cp, bool _IsConst>
 _LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_SINCE_CXX20 typename __bit_iterator<_Cp, _IsConst>::difference_type
@@ -85,7 +145,7 @@ template <class _InputIterator, class _Tp>
 [[__nodiscard__]] inline _LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_SINCE_CXX20 __iter_diff_t<_InputIterator>
 count(_InputIterator __first, _InputIterator __last, const _Tp& __value) {
   __identity __proj;
-  return std::__count<_ClassicAlgPolicy>(__first, __last, __value, __proj);
+  return std::__count<_ClassicAlgPolicy>(std::__unwrap_iter(__first), std::__unwrap_iter(__last), __value, __proj);
 }
 
 _LIBCPP_END_NAMESPACE_STD
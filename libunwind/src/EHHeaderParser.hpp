@@ -128,12 +128,21 @@ bool EHHeaderParser<A>::findFDE(A &addressSpace, pint_t pc, pint_t ehHdrStart,
   size_t tableEntrySize = getTableEntrySize(hdrInfo.table_enc);
   pint_t tableEntry;
 
+  // Every common linker emits the table as pairs of 32-bit offsets from the
+  // start of .eh_frame_hdr. Read those directly instead of going through the
+  // generic pointer decoding, since this search runs for every unwound frame.
+  const bool isDatarelSData4 =
+      hdrInfo.table_enc == (DW_EH_PE_datarel | DW_EH_PE_sdata4);
+
   size_t low = 0;
   for (size_t len = hdrInfo.fde_count; len > 1;) {
     size_t mid = low + (len / 2);
     tableEntry = hdrInfo.table + mid * tableEntrySize;
-    pint_t start = addressSpace.getEncodedP(tableEntry, ehHdrEnd,
-                                            hdrInfo.table_enc, ehHdrStart);
+    pint_t start =
+        isDatarelSData4
+            ? ehHdrStart + (pint_t)(int32_t)addressSpace.get32(tableEntry)
+            : addressSpace.getEncodedP(tableEntry, ehHdrEnd, hdrInfo.table_enc,
+                                       ehHdrStart);
 
     if (start == pc) {
       low = mid;
@@ -26,6 +26,7 @@
 #include "llvm/DebugInfo/PDB/Native/TpiHashing.h"
 #include "llvm/DebugInfo/PDB/Native/TpiStream.h"
 #include "llvm/Support/FormatVariadic.h"
+#include "llvm/Support/MathExtras.h"
 #include "llvm/Support/Parallel.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/TimeProfiler.h"
@@ -1136,10 +1137,28 @@ void TypeMerger::mergeTypesWithGHash() {
   // - item records
   //   - source 0, type 1...
   //   - source 1, type 0...
+  //
+  // The table is scanned in fixed-size chunks in parallel. The order in which
+  // the chunks are concatenated does not matter because of the sort.
+  constexpr size_t cellsPerChunk = 1 << 16;
+  size_t numChunks = divideCeil(tableSize, cellsPerChunk);
+  std::vector<std::vector<GHashCell>> chunkEntries(numChunks);
+  parallelFor(0, numChunks, [&](size_t chunk) {
+    size_t begin = chunk * cellsPerChunk;
+    size_t end = std::min(begin + cellsPerChunk, tableSize);
+    for (const GHashCell &cell :
+         ArrayRef(ghashState.table.table + begin, end - begin))
+      if (!cell.isEmpty())
+        chunkEntries[chunk].push_back(cell);
+  });
+  size_t numEntries = 0;
+  for (const std::vector<GHashCell> &v : chunkEntries)
+    numEntries += v.size();
   std::vector<GHashCell> entries;
-  for (const GHashCell &cell : ArrayRef(ghashState.table.table, tableSize)) {
-    if (!cell.isEmpty())
-      entries.push_back(cell);
+  entries.reserve(numEntries);
+  for (std::vector<GHashCell> &v : chunkEntries) {
+    entries.insert(entries.end(), v.begin(), v.end());
+    std::vector<GHashCell>().swap(v);
   }
   parallelSort(entries, std::less<GHashCell>());
   Log(ctx) << formatv(
@@ -1161,20 +1180,21 @@ void TypeMerger::mergeTypesWithGHash() {
   // merging will skip indices not on this list. Store the destination PDB type
   // index for these unique types in the tpiMap for each source. The entries for
   // non-unique types will be filled in prior to type merging.
-  for (uint32_t i = 0, e = entries.size(); i < e; ++i) {
-    auto &cell = entries[i];
-    uint32_t tpiSrcIdx = cell.getTpiSrcIdx();
-    TpiSource *source = ctx.tpiSourceList[tpiSrcIdx];
-    source->uniqueTypes.push_back(cell.getGHashIdx());
-
-    // Update the ghash table to store the destination PDB type index in the
-    // table.
+  for (const GHashCell &cell : entries)
+    ctx.tpiSourceList[cell.getTpiSrcIdx()]->uniqueTypes.push_back(
+        cell.getGHashIdx());
+
+  // Update the ghash table to store the destination PDB type index in the
+  // table. Every entry owns a distinct cell, so this is done in parallel.
+  parallelFor(0, entries.size(), [&](size_t i) {
+    const GHashCell &cell = entries[i];
+    TpiSource *source = ctx.tpiSourceList[cell.getTpiSrcIdx()];
     uint32_t pdbTypeIndex = i < numTypes ? i : i - numTypes;
     uint32_t ghashCellIndex =
         source->indexMapStorage[cell.getGHashIdx()].toArrayIndex();
     ghashState.table.table[ghashCellIndex] =
         GHashCell(cell.isItem(), cell.getTpiSrcIdx(), pdbTypeIndex);
-  }
+  });
 
   // In parallel, remap all types.
   for (TpiSource *source : dependencySources)
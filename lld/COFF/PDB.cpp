@@ -46,6 +46,7 @@
 #include "llvm/Support/Endian.h"
 #include "llvm/Support/FormatVariadic.h"
 #include "llvm/Support/Path.h"
+#include "llvm/Support/Parallel.h"
 #include "llvm/Support/ScopedPrinter.h"
 #include "llvm/Support/TimeProfiler.h"
 #include <memory>
@@ -1201,8 +1202,8 @@ void PDBLinker::addPublicsToPDB() {
   ScopedTimer t3(ctx.publicsLayoutTimer);
   // Compute the public symbols.
   auto &gsiBuilder = builder.getGsiBuilder();
-  std::vector<pdb::BulkPublic> publics;
-  ctx.symtab.forEachSymbol([&publics, this](Symbol *s) {
+  std::vector<Defined *> defs;
+  ctx.symtab.forEachSymbol([&defs, this](Symbol *s) {
     // Only emit external, defined, live symbols that have a chunk. Static,
     // non-external symbols do not appear in the symbol table.
     auto *def = dyn_cast<Defined>(s);
@@ -1223,10 +1224,15 @@ void PDBLinker::addPublicsToPDB() {
           return;
         }
       }
-      publics.push_back(createPublic(ctx, def));
+      defs.push_back(def);
     }
   });
 
+  // Names have been resolved above, so the records can be built in parallel.
+  std::vector<pdb::BulkPublic> publics(defs.size());
+  parallelFor(0, defs.size(),
+              [&](size_t i) { publics[i] = createPublic(ctx, defs[i]); });
+
   if (!publics.empty()) {
     publicSymbols = publics.size();
     gsiBuilder.addPublicSymbols(std::move(publics));
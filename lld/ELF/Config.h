@@ -302,6 +302,9 @@ struct Config {
   bool bpFunctionOrderForCompression = false;
   bool bpDataOrderForCompression = false;
   bool bpVerboseSectionOrderer = false;
+  // Place the sections of the call graph profile first, ordered by
+  // --call-graph-profile-sort, before the BP ordered sections.
+  bool bpCallGraphProfileFirst = false;
   bool checkSections;
   bool checkDynamicRelocs;
   std::optional<llvm::DebugCompressionType> compressDebugSections;
@@ -662,6 +665,9 @@ struct Ctx : CommonLinkerContext {
   SmallVector<Symbol *, 0> synthesizedSymbols;
 
   SmallVector<std::unique_ptr<MemoryBuffer>> memoryBuffers;
+  // Input files opened ahead of time by prefetchFiles(). readFile() takes
+  // ownership of an entry when the file is requested.
+  llvm::StringMap<std::unique_ptr<MemoryBuffer>> prefetchedBuffers;
   SmallVector<ELFFileBase *, 0> objectFiles;
   SmallVector<SharedFile *, 0> sharedFiles;
   SmallVector<BinaryFile *, 0> binaryFiles;
@@ -80,6 +80,7 @@
 #include "SymbolTable.h"
 #include "Symbols.h"
 #include "SyntheticSections.h"
+#include "llvm/ADT/StableHashing.h"
 #include "llvm/BinaryFormat/ELF.h"
 #include "llvm/Support/Parallel.h"
 #include "llvm/Support/TimeProfiler.h"
@@ -460,6 +461,20 @@ static void combineRelocHashes(unsigned cnt, InputSection *isec,
   isec->eqClass[(cnt + 1) % 2] = hash | (1U << 31);
 }
 
+// Mix the properties of relocations that equalsConstant requires to be
+// identical (count, offsets and types) into a section hash. Relocation targets
+// and addends are left to segregate() since their comparison depends on the
+// target kind.
+template <class RelTy>
+static stable_hash hashRelocShape(Ctx &ctx, stable_hash hash,
+                                  Relocs<RelTy> rels) {
+  hash = stable_hash_combine(hash, rels.size());
+  for (RelTy rel : rels)
+    hash = stable_hash_combine(hash, rel.r_offset,
+                               rel.getType(ctx.arg.isMips64EL));
+  return hash;
+}
+
 // The main function of ICF.
 template <class ELFT> void ICF<ELFT>::run() {
   // Two text sections may have identical content and relocations but different
@@ -488,10 +503,22 @@ template <class ELFT> void ICF<ELFT>::run() {
     }
   }
 
-  // Initially, we use hash values to partition sections.
+  // Initially, we use hash values to partition sections. Besides the content,
+  // hash the flags and the relocation offsets and types. In template-heavy
+  // code many sections have identical bytes and differ only in their
+  // relocations; separating them here leaves much less work for the quadratic
+  // worst case of segregate().
   parallelForEach(sections, [&](InputSection *s) {
+    stable_hash hash = stable_hash_combine(xxh3_64bits(s->content()), s->flags);
+    const RelsOrRelas<ELFT> rels = s->template relsOrRelas<ELFT>();
+    if (rels.areRelocsCrel())
+      hash = hashRelocShape(ctx, hash, rels.crels);
+    else if (rels.areRelocsRel())
+      hash = hashRelocShape(ctx, hash, rels.rels);
+    else
+      hash = hashRelocShape(ctx, hash, rels.relas);
     // Set MSB to 1 to avoid collisions with unique IDs.
-    s->eqClass[0] = xxh3_64bits(s->content()) | (1U << 31);
+    s->eqClass[0] = hash | (1U << 31);
   });
 
   // Perform 2 rounds of relocation hash propagation. 2 is an empirical value to
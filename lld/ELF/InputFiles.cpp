@@ -25,6 +25,7 @@
 #include "llvm/Support/ARMBuildAttributes.h"
 #include "llvm/Support/Endian.h"
 #include "llvm/Support/FileSystem.h"
+#include "llvm/Support/Parallel.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/TimeProfiler.h"
 #include "llvm/Support/raw_ostream.h"
@@ -249,15 +250,23 @@ std::optional<MemoryBufferRef> elf::readFile(Ctx &ctx, StringRef path) {
   Log(ctx) << path;
   ctx.arg.dependencyFiles.insert(llvm::CachedHashString(path));
 
-  auto mbOrErr = MemoryBuffer::getFile(path, /*IsText=*/false,
-                                       /*RequiresNullTerminator=*/false);
-  if (auto ec = mbOrErr.getError()) {
-    ErrAlways(ctx) << "cannot open " << path << ": " << ec.message();
-    return std::nullopt;
+  std::unique_ptr<MemoryBuffer> mb;
+  auto prefetched = ctx.prefetchedBuffers.find(path);
+  if (prefetched != ctx.prefetchedBuffers.end()) {
+    mb = std::move(prefetched->second);
+    ctx.prefetchedBuffers.erase(prefetched);
+  } else {
+    auto mbOrErr = MemoryBuffer::getFile(path, /*IsText=*/false,
+                                         /*RequiresNullTerminator=*/false);
+    if (auto ec = mbOrErr.getError()) {
+      ErrAlways(ctx) << "cannot open " << path << ": " << ec.message();
+      return std::nullopt;
+    }
+    mb = std::move(*mbOrErr);
   }
 
-  MemoryBufferRef mbref = (*mbOrErr)->getMemBufferRef();
-  ctx.memoryBuffers.push_back(std::move(*mbOrErr)); // take MB ownership
+  MemoryBufferRef mbref = mb->getMemBufferRef();
+  ctx.memoryBuffers.push_back(std::move(mb)); // take MB ownership
 
   if (ctx.tar)
     ctx.tar->append(relativeToRoot(path), mbref.getBuffer());
@@ -299,7 +308,9 @@ static bool isCompatible(Ctx &ctx, InputFile *file) {
   return false;
 }
 
-template <class ELFT> static void doParseFile(Ctx &ctx, InputFile *file) {
+template <class ELFT>
+static void doParseFile(Ctx &ctx, InputFile *file,
+                        ArrayRef<uint32_t> stemHashes = {}) {
   if (!isCompatible(ctx, file))
     return;
 
@@ -309,7 +320,7 @@ template <class ELFT> static void doParseFile(Ctx &ctx, InputFile *file) {
       ctx.lazyBitcodeFiles.push_back(f);
       f->parseLazy();
     } else {
-      cast<ObjFile<ELFT>>(file)->parseLazy();
+      cast<ObjFile<ELFT>>(file)->parseLazy(stemHashes);
     }
     return;
   }
@@ -331,6 +342,35 @@ template <class ELFT> static void doParseFile(Ctx &ctx, InputFile *file) {
   }
 }
 
+// Opens the given files in parallel, so that readFile() can pick them up
+// later without waiting for the file system. lld/MachO/InputFiles.cpp has the
+// same function; keep the two in step. Only the way a file is opened and the
+// cases where readFile() would not use the buffer differ.
+void elf::prefetchFiles(Ctx &ctx, ArrayRef<StringRef> paths) {
+  // readFile() may rewrite paths. Keep things simple and do not prefetch in
+  // that case.
+  if (!ctx.arg.chroot.empty() || !ctx.arg.remapInputs.empty() ||
+      !ctx.arg.remapInputsWildcards.empty())
+    return;
+  if (paths.size() < 2)
+    return;
+
+  llvm::TimeTraceScope timeScope("Prefetch input files");
+  SmallVector<std::unique_ptr<MemoryBuffer>, 0> mbs(paths.size());
+  parallelFor(0, paths.size(), [&](size_t i) {
+    // Errors are diagnosed by readFile() when the file is actually opened, so
+    // the file must be opened the same way as there.
+    ErrorOr<std::unique_ptr<MemoryBuffer>> mbOrErr =
+        MemoryBuffer::getFile(paths[i], /*IsText=*/false,
+                              /*RequiresNullTerminator=*/false);
+    if (mbOrErr)
+      mbs[i] = std::move(*mbOrErr);
+  });
+  for (auto [path, mb] : llvm::zip_equal(paths, mbs))
+    if (mb)
+      ctx.prefetchedBuffers.try_emplace(path, std::move(mb));
+}
+
 // Add symbols in File to the symbol table.
 void elf::parseFile(Ctx &ctx, InputFile *file) {
   invokeELFT(doParseFile, ctx, file);
@@ -343,16 +383,51 @@ extern template void ObjFile<ELF32BE>::importCmseSymbols();
 extern template void ObjFile<ELF64LE>::importCmseSymbols();
 extern template void ObjFile<ELF64BE>::importCmseSymbols();
 
+// Computes the symbol table hashes of the defined global symbol names of a
+// lazy object file. Returns an empty vector on a malformed symbol table, in
+// which case parseLazy() computes the hashes itself and reports the error.
+template <class ELFT>
+static SmallVector<uint32_t, 0> hashLazySymbols(Ctx &ctx, InputFile *file) {
+  if (!file->lazy || file->kind() != InputFile::ObjKind ||
+      file->ekind != ctx.arg.ekind)
+    return {};
+  auto *obj = cast<ObjFile<ELFT>>(file);
+  StringRef strtab = obj->getStringTable();
+  ArrayRef<typename ELFT::Sym> eSyms = obj->template getGlobalELFSyms<ELFT>();
+  SmallVector<uint32_t, 0> hashes(eSyms.size());
+  for (auto [i, sym] : llvm::enumerate(eSyms)) {
+    if (sym.st_shndx == SHN_UNDEF)
+      continue;
+    Expected<StringRef> name = sym.getName(strtab);
+    if (!name) {
+      consumeError(name.takeError());
+      return {};
+    }
+    hashes[i] = SymbolTable::getStemHash(*name);
+  }
+  return hashes;
+}
+
 template <class ELFT>
 static void
 doParseFiles(Ctx &ctx,
              const SmallVector<std::unique_ptr<InputFile>, 0> &files) {
+  // Symbol resolution is serial. For archive-heavy links, hashing the names of
+  // millions of lazy symbols is a large part of it, so do that in parallel
+  // beforehand.
+  SmallVector<SmallVector<uint32_t, 0>, 0> stemHashes(files.size());
+  parallelFor(0, files.size(), [&](size_t i) {
+    stemHashes[i] = hashLazySymbols<ELFT>(ctx, files[i].get());
+  });
+
   // Add all files to the symbol table. This will add almost all symbols that we
   // need to the symbol table. This process might add files to the link due to
   // addDependentLibrary.
   for (size_t i = 0; i < files.size(); ++i) {
     llvm::TimeTraceScope timeScope("Parse input files", files[i]->getName());
-    doParseFile<ELFT>(ctx, files[i].get());
+    doParseFile<ELFT>(ctx, files[i].get(),
+                      i < stemHashes.size() ? ArrayRef(stemHashes[i])
+                                            : ArrayRef<uint32_t>());
   }
   if (ctx.driver.armCmseImpLib)
     cast<ObjFile<ELFT>>(*ctx.driver.armCmseImpLib).importCmseSymbols();
@@ -1954,7 +2029,8 @@ std::unique_ptr<ELFFileBase> elf::createObjFile(Ctx &ctx, MemoryBufferRef mb,
   return f;
 }
 
-template <class ELFT> void ObjFile<ELFT>::parseLazy() {
+template <class ELFT>
+void ObjFile<ELFT>::parseLazy(ArrayRef<uint32_t> stemHashes) {
   const ArrayRef<typename ELFT::Sym> eSyms = this->getELFSyms<ELFT>();
   numSymbols = eSyms.size();
   symbols = std::make_unique<Symbol *[]>(numSymbols);
@@ -1966,7 +2042,10 @@ template <class ELFT> void ObjFile<ELFT>::parseLazy() {
   for (size_t i = firstGlobal, end = eSyms.size(); i != end; ++i) {
     if (eSyms[i].st_shndx == SHN_UNDEF)
       continue;
-    symbols[i] = symtab->insert(CHECK2(eSyms[i].getName(stringTable), this));
+    StringRef name = CHECK2(eSyms[i].getName(stringTable), this);
+    symbols[i] = stemHashes.empty()
+                     ? symtab->insert(name)
+                     : symtab->insert(name, stemHashes[i - firstGlobal]);
     symbols[i]->resolve(ctx, LazySymbol{*this});
     if (!lazy)
       break;
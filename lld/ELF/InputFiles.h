@@ -42,6 +42,10 @@ const ELFSyncStream &operator<<(const ELFSyncStream &, const InputFile *);
 // Opens a given file.
 std::optional<MemoryBufferRef> readFile(Ctx &, StringRef path);
 
+// Opens the given files in parallel so that subsequent readFile() calls for
+// them do not need to go to the file system.
+void prefetchFiles(Ctx &, ArrayRef<StringRef> paths);
+
 // Add symbols in File to the symbol table.
 void parseFile(Ctx &, InputFile *file);
 void parseFiles(Ctx &, const SmallVector<std::unique_ptr<InputFile>, 0> &);
@@ -261,7 +265,9 @@ public:
   }
 
   void parse(bool ignoreComdats = false);
-  void parseLazy();
+  // If given, stemHashes holds SymbolTable::getStemHash() of each global
+  // symbol name (see hashLazySymbols()).
+  void parseLazy(ArrayRef<uint32_t> stemHashes = {});
 
   StringRef getShtGroupSignature(ArrayRef<Elf_Shdr> sections,
                                  const Elf_Shdr &sec);
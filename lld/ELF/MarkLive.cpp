@@ -30,6 +30,7 @@
 #include "lld/Common/Strings.h"
 #include "llvm/ADT/DenseMapInfoVariant.h"
 #include "llvm/ADT/STLExtras.h"
+#include "llvm/Support/Parallel.h"
 #include "llvm/Support/TimeProfiler.h"
 #include <variant>
 #include <vector>
@@ -66,6 +67,7 @@ private:
                LiveReason reason);
   void markSymbol(Symbol *sym, StringRef reason);
   void mark();
+  void markParallel();
 
   template <class RelTy>
   void resolveReloc(InputSectionBase &sec, RelTy &rel, bool fromFDE);
@@ -73,6 +75,19 @@ private:
   template <class RelTy>
   void scanEhFrameSection(EhInputSection &eh, ArrayRef<RelTy> rels);
 
+  // Sections and symbols discovered by one worker of markParallel(). They are
+  // applied serially so that the traversal does not race on section and
+  // symbol state.
+  struct PendingWork {
+    SmallVector<std::pair<InputSectionBase *, uint64_t>, 0> sections;
+    SmallVector<Symbol *, 0> usedSyms;
+  };
+
+  template <class RelTy>
+  void collectReloc(InputSectionBase &sec, const RelTy &rel,
+                    PendingWork &work) const;
+  void collectSection(InputSection &sec, PendingWork &work) const;
+
   Ctx &ctx;
   // The index of the partition that we are currently processing.
   unsigned partition;
@@ -444,6 +459,13 @@ void MarkLive<ELFT, TrackWhyLive>::run() {
 
 template <class ELFT, bool TrackWhyLive>
 void MarkLive<ELFT, TrackWhyLive>::mark() {
+  // --why-live records the first discovered reason for each item, which
+  // depends on the visit order. Keep the serial traversal in that case.
+  if (!TrackWhyLive && ctx.arg.threadCount > 1) {
+    markParallel();
+    return;
+  }
+
   // Mark all reachable sections.
   while (!queue.empty()) {
     InputSectionBase &sec = *queue.pop_back_val();
@@ -467,6 +489,94 @@ void MarkLive<ELFT, TrackWhyLive>::mark() {
   }
 }
 
+// The parallel counterpart of resolveReloc. It only reads section and symbol
+// state; the updates are recorded in `work` and applied by markParallel().
+template <class ELFT, bool TrackWhyLive>
+template <class RelTy>
+void MarkLive<ELFT, TrackWhyLive>::collectReloc(InputSectionBase &sec,
+                                                const RelTy &rel,
+                                                PendingWork &work) const {
+  Symbol &sym = sec.file->getRelocTargetSym(rel);
+  if (!sym.used || isa<SharedSymbol>(sym))
+    work.usedSyms.push_back(&sym);
+
+  if (auto *d = dyn_cast<Defined>(&sym)) {
+    auto *relSec = dyn_cast_or_null<InputSectionBase>(d->section);
+    if (!relSec)
+      return;
+    // Sections that are already in the final partition need not be visited
+    // again, unless a piece of a mergeable section has to be marked.
+    if (!isa<MergeInputSection>(relSec) &&
+        (relSec->partition == 1 || relSec->partition == partition))
+      return;
+    uint64_t offset = d->value;
+    if (d->isSection())
+      offset += getAddend<ELFT>(ctx, sec, rel);
+    work.sections.emplace_back(relSec, offset);
+    return;
+  }
+
+  auto it = cNamedSections.find(sym.getName());
+  if (it != cNamedSections.end())
+    for (InputSectionBase *s : it->second)
+      work.sections.emplace_back(s, 0);
+}
+
+template <class ELFT, bool TrackWhyLive>
+void MarkLive<ELFT, TrackWhyLive>::collectSection(InputSection &sec,
+                                                  PendingWork &work) const {
+  const RelsOrRelas<ELFT> rels = sec.template relsOrRelas<ELFT>();
+  for (const typename ELFT::Rel &rel : rels.rels)
+    collectReloc(sec, rel, work);
+  for (const typename ELFT::Rela &rel : rels.relas)
+    collectReloc(sec, rel, work);
+  for (const typename ELFT::Crel &rel : rels.crels)
+    collectReloc(sec, rel, work);
+
+  for (InputSectionBase *isec : sec.dependentSections)
+    work.sections.emplace_back(isec, 0);
+  if (sec.nextInSectionGroup)
+    work.sections.emplace_back(sec.nextInSectionGroup, 0);
+}
+
+// Mark all reachable sections, one frontier at a time. Relocations of the
+// sections in the current frontier are scanned in parallel, and the sections
+// they reach are then enqueued serially in a deterministic order to form the
+// next frontier. The resulting set of live sections is the same as with the
+// serial traversal.
+template <class ELFT, bool TrackWhyLive>
+void MarkLive<ELFT, TrackWhyLive>::markParallel() {
+  SmallVector<InputSection *, 0> frontier;
+  SmallVector<PendingWork, 0> work;
+  while (!queue.empty()) {
+    frontier = std::move(queue);
+    queue.clear();
+
+    // Small frontiers are not worth the scheduling overhead.
+    const size_t numShards =
+        frontier.size() < 256 ? 1 : std::min<size_t>(ctx.arg.threadCount, 64);
+    const size_t shardSize = divideCeil(frontier.size(), numShards);
+    work.assign(numShards, PendingWork());
+    parallelFor(0, numShards, [&](size_t i) {
+      size_t begin = std::min(i * shardSize, frontier.size());
+      size_t end = std::min(begin + shardSize, frontier.size());
+      for (InputSection *sec : ArrayRef(frontier).slice(begin, end - begin))
+        collectSection(*sec, work[i]);
+    });
+
+    for (PendingWork &w : work) {
+      for (Symbol *sym : w.usedSyms) {
+        sym->used = true;
+        if (auto *ss = dyn_cast<SharedSymbol>(sym))
+          if (!ss->isWeak())
+            cast<SharedFile>(ss->file)->isNeeded = true;
+      }
+      for (auto [sec, offset] : w.sections)
+        enqueue(sec, offset, /*sym=*/nullptr, /*reason=*/{});
+    }
+  }
+}
+
 // Move the sections for some symbols to the main partition, specifically ifuncs
 // (because they can result in an IRELATIVE being added to the main partition's
 // GOT, which means that the ifunc must be available when the main partition is
@@ -412,28 +412,41 @@ template <class ELFT> void OutputSection::maybeCompress(Ctx &ctx) {
   // Use ZSTD's streaming compression API. See
   // http://facebook.github.io/zstd/zstd_manual.html "Streaming compression -
   // HowTo".
+  //
+  // Each shard is an independent zstd frame. Creating a compression context
+  // allocates and initializes several MiB of tables, so a context is reused
+  // for a group of consecutive shards instead of being created per shard.
+  // Groups are kept small enough that there are several tasks per thread.
   if (ctype == DebugCompressionType::Zstd) {
-    parallelFor(0, numShards, [&](size_t i) {
-      SmallVector<uint8_t, 0> out;
+    const size_t shardsPerTask = std::max<size_t>(
+        1, numShards / (4 * parallel::strategy.compute_thread_count()));
+    parallelFor(0, divideCeil(numShards, shardsPerTask), [&](size_t task) {
       ZSTD_CCtx *cctx = ZSTD_createCCtx();
       ZSTD_CCtx_setParameter(cctx, ZSTD_c_compressionLevel, level);
-      ZSTD_inBuffer zib = {shardsIn[i].data(), shardsIn[i].size(), 0};
-      ZSTD_outBuffer zob = {nullptr, 0, 0};
-      size_t size;
-      do {
-        // Allocate a buffer of half of the input size, and grow it by 1.5x if
-        // insufficient.
-        if (zob.pos == zob.size) {
-          out.resize_for_overwrite(
-              zob.size ? zob.size * 3 / 2 : std::max<size_t>(zib.size / 4, 64));
-          zob = {out.data(), out.size(), zob.pos};
-        }
-        size = ZSTD_compressStream2(cctx, &zob, &zib, ZSTD_e_end);
-        assert(!ZSTD_isError(size));
-      } while (size != 0);
-      out.truncate(zob.pos);
+      size_t end = std::min(numShards, (task + 1) * shardsPerTask);
+      for (size_t i = task * shardsPerTask; i != end; ++i) {
+        SmallVector<uint8_t, 0> out;
+        ZSTD_inBuffer zib = {shardsIn[i].data(), shardsIn[i].size(), 0};
+        ZSTD_outBuffer zob = {nullptr, 0, 0};
+        size_t size;
+        do {
+          // Allocate a buffer of half of the input size, and grow it by 1.5x
+          // if insufficient.
+          if (zob.pos == zob.size) {
+            out.resize_for_overwrite(zob.size ? zob.size * 3 / 2
+                                              : std::max<size_t>(zib.size / 4,
+                                                                 64));
+            zob = {out.data(), out.size(), zob.pos};
+          }
+          size = ZSTD_compressStream2(cctx, &zob, &zib, ZSTD_e_end);
+          assert(!ZSTD_isError(size));
+        } while (size != 0);
+        out.truncate(zob.pos);
+        shardsOut[i] = std::move(out);
+        // Start a new frame, keeping the compression parameters.
+        ZSTD_CCtx_reset(cctx, ZSTD_reset_session_only);
+      }
       ZSTD_freeCCtx(cctx);
-      shardsOut[i] = std::move(out);
     });
     compressed.type = ELFCOMPRESS_ZSTD;
     for (size_t i = 0; i != numShards; ++i)
@@ -1701,19 +1701,26 @@ template <class ELFT> void elf::scanRelocations(Ctx &ctx) {
   parallel::TaskGroup tg;
   auto outerFn = [&]() {
     for (ELFFileBase *f : ctx.objectFiles) {
-      auto fn = [f, &ctx]() {
+      auto fn = [&ctx](ArrayRef<InputSectionBase *> sections) {
         RelocationScanner scanner(ctx);
-        for (InputSectionBase *s : f->getSections()) {
+        for (InputSectionBase *s : sections) {
           if (s && s->kind() == SectionBase::Regular && s->isLive() &&
               (s->flags & SHF_ALLOC) &&
               !(s->type == SHT_ARM_EXIDX && ctx.arg.emachine == EM_ARM))
             scanner.template scanSection<ELFT>(*s);
         }
       };
-      if (serial)
-        fn();
-      else
-        tg.spawn(fn);
+      ArrayRef<InputSectionBase *> sections = f->getSections();
+      if (serial) {
+        fn(sections);
+        continue;
+      }
+      // A large monolithic object file (e.g. a unity build compiled with
+      // -ffunction-sections) would otherwise be scanned by a single task.
+      // Sections are scanned independently, so split such files into chunks.
+      constexpr size_t chunkSize = 4096;
+      for (size_t i = 0, e = sections.size(); i < e; i += chunkSize)
+        tg.spawn([=] { fn(sections.slice(i, std::min(chunkSize, e - i))); });
     }
     auto scanEH = [&] {
       RelocationScanner scanner(ctx);
@@ -2433,8 +2440,36 @@ bool ThunkCreator::createThunks(uint32_t pass,
   // InputSectionDescription as the caller.
   forEachInputSectionDescription(
       outputSections, [&](OutputSection *os, InputSectionDescription *isd) {
-        for (InputSection *isec : isd->sections)
-          for (Relocation &rel : isec->relocs()) {
+        // Addresses of input sections and of symbols outside ThunkSections do
+        // not change until mergeThunks(), so whether a relocation needs to be
+        // looked at can be decided for all relocations in parallel. Thunk
+        // creation and placement below stays serial and in relocation order.
+        SmallVector<size_t, 0> relBegin;
+        std::vector<uint8_t> candidate;
+        if (ctx.arg.threadCount > 1) {
+          relBegin.reserve(isd->sections.size() + 1);
+          size_t numRelocs = 0;
+          for (InputSection *isec : isd->sections) {
+            relBegin.push_back(numRelocs);
+            numRelocs += isec->relocs().size();
+          }
+          relBegin.push_back(numRelocs);
+          candidate.resize(numRelocs);
+          parallelFor(0, isd->sections.size(), [&](size_t i) {
+            InputSection *isec = isd->sections[i];
+            uint8_t *out = candidate.data() + relBegin[i];
+            for (const Relocation &rel : isec->relocs())
+              *out++ = (pass > 0 && thunks.count(rel.sym)) ||
+                       ctx.target->needsThunk(rel.expr, rel.type, isec->file,
+                                              isec->getVA(rel.offset),
+                                              *rel.sym, rel.addend);
+          });
+        }
+
+        for (auto [i, isec] : llvm::enumerate(isd->sections))
+          for (auto [j, rel] : llvm::enumerate(isec->relocs())) {
+            if (!candidate.empty() && !candidate[relBegin[i] + j])
+              continue;
             uint64_t src = isec->getVA(rel.offset);
 
             // If we are a relocation to an existing Thunk, check if it is
@@ -60,19 +60,31 @@ void SymbolTable::wrap(Symbol *sym, Symbol *real, Symbol *wrap) {
 }
 
 // Find an existing symbol or create a new one.
-Symbol *SymbolTable::insert(StringRef name) {
-  // <name>@@<version> means the symbol is the default version. In that
-  // case <name>@@<version> will be used to resolve references to <name>.
-  //
-  // Since this is a hot path, the following string search code is
-  // optimized for speed. StringRef::find(char) is much faster than
-  // StringRef::find(StringRef).
-  StringRef stem = name;
-  size_t pos = name.find('@');
+// <name>@@<version> means the symbol is the default version. In that
+// case <name>@@<version> will be used to resolve references to <name>.
+//
+// Since this is a hot path, the following string search code is
+// optimized for speed. StringRef::find(char) is much faster than
+// StringRef::find(StringRef).
+static StringRef getStem(StringRef name, size_t pos) {
   if (pos != StringRef::npos && pos + 1 < name.size() && name[pos + 1] == '@')
-    stem = name.take_front(pos);
+    return name.take_front(pos);
+  return name;
+}
+
+uint32_t SymbolTable::getStemHash(StringRef name) {
+  return CachedHashStringRef(getStem(name, name.find('@'))).hash();
+}
 
-  auto p = symMap.insert({CachedHashStringRef(stem), (int)symVector.size()});
+Symbol *SymbolTable::insert(StringRef name) {
+  return insert(name, getStemHash(name));
+}
+
+Symbol *SymbolTable::insert(StringRef name, uint32_t stemHash) {
+  size_t pos = name.find('@');
+  StringRef stem = getStem(name, pos);
+  auto p = symMap.insert(
+      {CachedHashStringRef(stem, stemHash), (int)symVector.size()});
   if (!p.second) {
     Symbol *sym = symVector[p.first->second];
     if (stem.size() != name.size()) {
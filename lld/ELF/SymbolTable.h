@@ -44,6 +44,10 @@ public:
   void wrap(Symbol *sym, Symbol *real, Symbol *wrap);
 
   Symbol *insert(StringRef name);
+  // Same as insert(name), but takes the hash of the unversioned name, which
+  // callers may compute in parallel with getStemHash().
+  Symbol *insert(StringRef name, uint32_t stemHash);
+  static uint32_t getStemHash(StringRef name);
 
   template <typename T> Symbol *addSymbol(const T &newSym) {
     Symbol *sym = insert(newSym.getName());
@@ -340,7 +340,11 @@ public:
   uint8_t referencedAfterWrap : 1;
 
   void setFlags(uint16_t bits) {
-    flags.fetch_or(bits, std::memory_order_relaxed);
+    // Heavily referenced symbols (e.g. memcpy) get the same bits set by many
+    // scanning threads. Skip the read-modify-write when nothing would change
+    // to avoid bouncing the cache line between cores.
+    if ((flags.load(std::memory_order_relaxed) & bits) != bits)
+      flags.fetch_or(bits, std::memory_order_relaxed);
   }
   bool hasFlag(uint16_t bit) const {
     assert(llvm::has_single_bit(bit) && "bit must be a power of 2");
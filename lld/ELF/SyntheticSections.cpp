@@ -54,6 +54,7 @@ using llvm::support::endian::read32le;
 using llvm::support::endian::write32le;
 using llvm::support::endian::write64le;
 
+constexpr size_t MergeTailSection::numShards;
 constexpr size_t MergeNoTailSection::numShards;
 
 static uint64_t readUint(Ctx &ctx, uint8_t *buf) {
@@ -573,30 +574,44 @@ void EhFrameSection::finalizeContents() {
 // returns a list of such pairs.
 SmallVector<EhFrameSection::FdeData, 0> EhFrameSection::getFdeData() const {
   uint8_t *buf = ctx.bufferStart + getParent()->offset + outSecOff;
-  SmallVector<FdeData, 0> ret;
 
-  uint64_t va = getPartition(ctx).ehFrameHdr->getVA();
+  // Collect FDEs in output order, then read their PCs in parallel. There is
+  // one FDE per function, so there may be millions of them.
+  SmallVector<std::pair<EhSectionPiece *, uint8_t>, 0> fdes;
+  fdes.reserve(numFdes);
   for (CieRecord *rec : cieRecords) {
     uint8_t enc = getFdeEncoding(rec->cie);
-    for (EhSectionPiece *fde : rec->fdes) {
-      uint64_t pc = getFdePc(buf, fde->outputOff, enc);
-      uint64_t fdeVA = getParent()->addr + fde->outputOff;
-      if (!isInt<32>(pc - va)) {
-        Err(ctx) << fde->sec << ": PC offset is too large: 0x"
-                 << Twine::utohexstr(pc - va);
-        continue;
-      }
-      ret.push_back({uint32_t(pc - va), uint32_t(fdeVA - va)});
+    for (EhSectionPiece *fde : rec->fdes)
+      fdes.emplace_back(fde, enc);
+  }
+  SmallVector<uint64_t, 0> pcs(fdes.size());
+  parallelFor(0, fdes.size(), [&](size_t i) {
+    pcs[i] = getFdePc(buf, fdes[i].first->outputOff, fdes[i].second);
+  });
+
+  SmallVector<FdeData, 0> ret;
+  ret.reserve(fdes.size());
+  uint64_t va = getPartition(ctx).ehFrameHdr->getVA();
+  for (auto [fdeAndEnc, pc] : llvm::zip_equal(fdes, pcs)) {
+    EhSectionPiece *fde = fdeAndEnc.first;
+    uint64_t fdeVA = getParent()->addr + fde->outputOff;
+    if (!isInt<32>(pc - va)) {
+      Err(ctx) << fde->sec << ": PC offset is too large: 0x"
+               << Twine::utohexstr(pc - va);
+      continue;
     }
+    ret.push_back({uint32_t(pc - va), uint32_t(fdeVA - va)});
   }
 
   // Sort the FDE list by their PC and uniqueify. Usually there is only
   // one FDE for a PC (i.e. function), but if ICF merges two functions
   // into one, there can be more than one FDEs pointing to the address.
+  // FDE addresses increase in the order they were collected, so breaking
+  // ties with fdeVARel gives the same result as a stable sort by PC.
   auto less = [](const FdeData &a, const FdeData &b) {
-    return a.pcRel < b.pcRel;
+    return a.pcRel != b.pcRel ? a.pcRel < b.pcRel : a.fdeVARel < b.fdeVARel;
   };
-  llvm::stable_sort(ret, less);
+  parallelSort(ret, less);
   auto eq = [](const FdeData &a, const FdeData &b) {
     return a.pcRel == b.pcRel;
   };
@@ -3947,33 +3962,67 @@ void MergeSyntheticSection::addSection(MergeInputSection *ms) {
   addralign = std::max(addralign, ms->addralign);
 }
 
-MergeTailSection::MergeTailSection(Ctx &ctx, StringRef name, uint32_t type,
-                                   uint64_t flags, uint32_t alignment)
-    : MergeSyntheticSection(ctx, name, type, flags, alignment),
-      builder(StringTableBuilder::RAW, llvm::Align(alignment)) {}
+void MergeTailSection::writeTo(uint8_t *buf) {
+  parallelFor(0, numShards,
+              [&](size_t i) { shards[i].write(buf + shardOffsets[i]); });
+}
 
-size_t MergeTailSection::getSize() const { return builder.getSize(); }
+// Tail merging sorts all strings by their reversed contents, which used to be
+// a long serial step for large .debug_str and .rodata.str sections. Since
+// strings with different last characters can never be tail-merged, we
+// partition the strings by that character and tail-merge each shard in
+// parallel. Only strings consisting of just a terminator may lose a merge
+// opportunity, which costs at most one entry per output section.
+void MergeTailSection::finalizeContents() {
+  // Initializes string table builders.
+  for (size_t i = 0; i < numShards; ++i)
+    shards.emplace_back(StringTableBuilder::RAW, llvm::Align(addralign));
 
-void MergeTailSection::writeTo(uint8_t *buf) { builder.write(buf); }
+  // Concurrency level. Must be a power of 2 to avoid expensive modulo
+  // operations in the following tight loop.
+  const size_t concurrency =
+      llvm::bit_floor(std::min<size_t>(ctx.arg.threadCount, numShards));
 
-void MergeTailSection::finalizeContents() {
-  // Add all string pieces to the string table builder to create section
-  // contents.
-  for (MergeInputSection *sec : sections)
-    for (size_t i = 0, e = sec->pieces.size(); i != e; ++i)
-      if (sec->pieces[i].live)
-        builder.add(sec->getData(i));
+  // Add section pieces to the builders.
+  parallelFor(0, concurrency, [&](size_t threadId) {
+    for (MergeInputSection *sec : sections) {
+      for (size_t i = 0, e = sec->pieces.size(); i != e; ++i) {
+        if (!sec->pieces[i].live)
+          continue;
+        CachedHashStringRef s = sec->getData(i);
+        size_t shardId = getShardId(s.val());
+        if ((shardId & (concurrency - 1)) == threadId)
+          shards[shardId].add(s);
+      }
+    }
+  });
 
-  // Fix the string table content. After this, the contents will never change.
-  builder.finalize();
+  // Fix the string table contents. After this, the contents will never change.
+  parallelFor(0, numShards, [&](size_t i) { shards[i].finalize(); });
+
+  // Compute an in-section offset for each shard.
+  size_t off = 0;
+  for (size_t i = 0; i < numShards; ++i) {
+    if (shards[i].getSize() > 0)
+      off = alignToPowerOf2(off, addralign);
+    shardOffsets[i] = off;
+    off += shards[i].getSize();
+  }
+  size = off;
 
   // finalize() fixed tail-optimized strings, so we can now get
   // offsets of strings. Get an offset for each string and save it
   // to a corresponding SectionPiece for easy access.
-  for (MergeInputSection *sec : sections)
-    for (size_t i = 0, e = sec->pieces.size(); i != e; ++i)
-      if (sec->pieces[i].live)
-        sec->pieces[i].outputOff = builder.getOffset(sec->getData(i));
+  parallelForEach(sections, [&](MergeInputSection *sec) {
+    for (size_t i = 0, e = sec->pieces.size(); i != e; ++i) {
+      if (!sec->pieces[i].live)
+        continue;
+      CachedHashStringRef s = sec->getData(i);
+      size_t shardId = getShardId(s.val());
+      sec->pieces[i].outputOff =
+          shardOffsets[shardId] + shards[shardId].getOffset(s);
+    }
+  });
 }
 
 void MergeNoTailSection::writeTo(uint8_t *buf) {
@@ -1108,14 +1108,30 @@ protected:
 class MergeTailSection final : public MergeSyntheticSection {
 public:
   MergeTailSection(Ctx &ctx, StringRef name, uint32_t type, uint64_t flags,
-                   uint32_t addralign);
+                   uint32_t addralign)
+      : MergeSyntheticSection(ctx, name, type, flags, addralign) {}
 
-  size_t getSize() const override;
+  size_t getSize() const override { return size; }
   void writeTo(uint8_t *buf) override;
   void finalizeContents() override;
 
 private:
-  llvm::StringTableBuilder builder;
+  // A string can only be a suffix of another string if both end with the same
+  // character, so we shard strings by their last character (the one before
+  // the terminator). Strings consisting of just a terminator go to shard 0.
+  size_t getShardId(StringRef s) const {
+    if (s.size() <= entsize)
+      return 0;
+    return uint8_t(s[s.size() - entsize - 1]) % numShards;
+  }
+
+  // Section size
+  size_t size;
+
+  // String table contents
+  constexpr static size_t numShards = 32;
+  SmallVector<llvm::StringTableBuilder, 0> shards;
+  size_t shardOffsets[numShards];
 };
 
 class MergeNoTailSection final : public MergeSyntheticSection {
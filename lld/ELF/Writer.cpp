@@ -1099,6 +1099,20 @@ static DenseMap<const InputSectionBase *, int> buildSectionOrder(Ctx &ctx) {
         ctx.arg.bpDataOrderForCompression,
         ctx.arg.bpCompressionSortStartupFunctions,
         ctx.arg.bpVerboseSectionOrderer);
+
+    // Lay out the sections of the call graph profile first, in the order
+    // computed from the profile, and the rest in balanced partitioning order.
+    // Call graph priorities are negative, so shifting them by the lowest
+    // balanced partitioning priority places them before all other sections.
+    if (ctx.arg.bpCallGraphProfileFirst && !ctx.arg.callGraphProfile.empty()) {
+      DenseMap<const InputSectionBase *, int> cgOrder =
+          computeCallGraphProfileOrder(ctx);
+      int base = 0;
+      for (auto [sec, prio] : sectionOrder)
+        base = std::min(base, prio);
+      for (auto [sec, prio] : cgOrder)
+        sectionOrder[sec] = base + prio;
+    }
   } else if (!ctx.arg.callGraphProfile.empty()) {
     sectionOrder = computeCallGraphProfileOrder(ctx);
   }
@@ -2998,7 +3012,9 @@ template <class ELFT> void Writer<ELFT>::writeSections() {
   {
     // In -r or --emit-relocs mode, write the relocation sections first as in
     // ELf_Rel targets we might find out that we need to modify the relocated
-    // section while doing it.
+    // section while doing it. This is needed for SHT_RELA and SHT_CREL as
+    // well: copyRelocations may decompress the relocated section, which must
+    // not happen while that section is being written.
     parallel::TaskGroup tg;
     for (OutputSection *sec : ctx.outputSections)
       if (isStaticRelSecType(sec->type))
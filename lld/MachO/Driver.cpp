@@ -366,7 +366,12 @@ static InputFile *addFile(StringRef path, LoadType loadType,
       // we already found that it contains an ObjC symbol.
       if (readFile(path)) {
         Error e = Error::success();
-        for (const object::Archive::Child &c : file->getArchive().children(e)) {
+        // Opening a member may extend the archive's list of thin member
+        // buffers, so collect the buffers serially and keep them for the scan.
+        SmallVector<std::pair<object::Archive::Child, MemoryBufferRef>, 0>
+            members;
+        for (const object::Archive::Child &c :
+             file->getArchive().children(e)) {
           Expected<MemoryBufferRef> mb = c.getMemoryBufferRef();
           if (!mb) {
             // We used to create broken repro tarballs that only included those
@@ -378,16 +383,27 @@ static InputFile *addFile(StringRef path, LoadType loadType,
               llvm::consumeError(mb.takeError());
             continue;
           }
+          members.emplace_back(c, *mb);
+        }
+        if (e)
+          error(toString(file) +
+                ": Archive::children failed: " + toString(std::move(e)));
+
+        // Scanning the section headers of every member dominates -ObjC loads
+        // of large archives. The scan only reads the member buffers, so do it
+        // in parallel and fetch the matching members in archive order below.
+        std::vector<uint8_t> needed(members.size());
+        parallelFor(0, members.size(), [&](size_t i) {
+          needed[i] = hasObjCSection(members[i].second);
+        });
 
-          if (!hasObjCSection(*mb))
+        for (auto [i, member] : llvm::enumerate(members)) {
+          if (!needed[i])
             continue;
-          if (Error e = file->fetch(c, "-ObjC"))
+          if (Error e = file->fetch(member.first, "-ObjC", member.second))
             error(toString(file) + ": -ObjC failed to load archive member: " +
                   toString(std::move(e)));
         }
-        if (e)
-          error(toString(file) +
-                ": Archive::children failed: " + toString(std::move(e)));
       }
     }
     file->addLazySymbols();
@@ -569,8 +585,12 @@ static void addFileList(StringRef path, bool isLazy) {
   if (!buffer)
     return;
   MemoryBufferRef mbref = *buffer;
+  SmallVector<StringRef, 0> paths;
   for (StringRef path : args::getLines(mbref))
-    addFile(rerootPath(path), LoadType::CommandLine, isLazy);
+    paths.push_back(rerootPath(path));
+  prefetchFiles(paths);
+  for (StringRef path : paths)
+    addFile(path, LoadType::CommandLine, isLazy);
 }
 
 // We expect sub-library names of the form "libfoo", which will match a dylib
@@ -1222,6 +1242,12 @@ static void createFiles(const InputArgList &args) {
   bool isLazy = false;
   // If we've processed an opening --start-lib, without a matching --end-lib
   bool inLib = false;
+
+  SmallVector<StringRef, 0> inputPaths;
+  for (const Arg *arg : args.filtered(OPT_INPUT))
+    inputPaths.push_back(rerootPath(arg->getValue()));
+  prefetchFiles(inputPaths);
+
   for (const Arg *arg : args) {
     const Option &opt = arg->getOption();
     warnIfDeprecatedOption(opt);
@@ -1545,6 +1571,7 @@ bool link(ArrayRef<const char *> argsArr, llvm::raw_ostream &stdoutOS,
     resolvedFrameworks.clear();
     resolvedLibraries.clear();
     cachedReads.clear();
+    prefetchedBuffers.clear();
     concatOutputSections.clear();
     inputFiles.clear();
     inputSections.clear();
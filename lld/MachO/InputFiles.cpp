@@ -65,6 +65,7 @@
 #include "llvm/Support/BinaryStreamReader.h"
 #include "llvm/Support/Endian.h"
 #include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/Parallel.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/TarWriter.h"
 #include "llvm/Support/TimeProfiler.h"
@@ -210,6 +211,9 @@ static bool compatWithTargetArch(const InputFile *file, const Header *hdr) {
 // Theoretically this caching could be more efficient by hoisting it, but that
 // would require altering many callers to track the state.
 DenseMap<CachedHashStringRef, MemoryBufferRef> macho::cachedReads;
+DenseMap<CachedHashStringRef, std::unique_ptr<MemoryBuffer>>
+    macho::prefetchedBuffers;
+
 // Open a given file path and return it as a memory-mapped file.
 std::optional<MemoryBufferRef> macho::readFile(StringRef path) {
   CachedHashStringRef key(path);
@@ -217,13 +221,21 @@ std::optional<MemoryBufferRef> macho::readFile(StringRef path) {
   if (entry != cachedReads.end())
     return entry->second;
 
-  ErrorOr<std::unique_ptr<MemoryBuffer>> mbOrErr = MemoryBuffer::getFile(path);
-  if (std::error_code ec = mbOrErr.getError()) {
-    error("cannot open " + path + ": " + ec.message());
-    return std::nullopt;
+  std::unique_ptr<MemoryBuffer> mb;
+  auto prefetched = prefetchedBuffers.find(key);
+  if (prefetched != prefetchedBuffers.end()) {
+    mb = std::move(prefetched->second);
+    prefetchedBuffers.erase(prefetched);
+  } else {
+    ErrorOr<std::unique_ptr<MemoryBuffer>> mbOrErr =
+        MemoryBuffer::getFile(path);
+    if (std::error_code ec = mbOrErr.getError()) {
+      error("cannot open " + path + ": " + ec.message());
+      return std::nullopt;
+    }
+    mb = std::move(*mbOrErr);
   }
 
-  std::unique_ptr<MemoryBuffer> &mb = *mbOrErr;
   MemoryBufferRef mbref = mb->getMemBufferRef();
   make<std::unique_ptr<MemoryBuffer>>(std::move(mb)); // take mb ownership
 
@@ -283,6 +295,32 @@ std::optional<MemoryBufferRef> macho::readFile(StringRef path) {
   return std::nullopt;
 }
 
+// Opens the given files in parallel, so that readFile() can pick them up
+// later without waiting for the file system. lld/ELF/InputFiles.cpp has the
+// same function; keep the two in step. Only the way a file is opened and the
+// cases where readFile() would not use the buffer differ.
+void macho::prefetchFiles(ArrayRef<StringRef> paths) {
+  if (paths.size() < 2)
+    return;
+
+  TimeTraceScope timeScope("Prefetch input files");
+  SmallVector<std::unique_ptr<MemoryBuffer>, 0> mbs(paths.size());
+  parallelFor(0, paths.size(), [&](size_t i) {
+    // Errors are diagnosed by readFile() when the file is actually opened, so
+    // the file must be opened the same way as there.
+    ErrorOr<std::unique_ptr<MemoryBuffer>> mbOrErr =
+        MemoryBuffer::getFile(paths[i]);
+    if (mbOrErr)
+      mbs[i] = std::move(*mbOrErr);
+  });
+  // readFile() returns files it has already read from cachedReads.
+  for (auto [path, mb] : llvm::zip_equal(paths, mbs)) {
+    CachedHashStringRef key(path);
+    if (mb && !cachedReads.count(key))
+      prefetchedBuffers.try_emplace(key, std::move(mb));
+  }
+}
+
 InputFile::InputFile(Kind kind, const InterfaceFile &interface)
     : id(idCount++), fileKind(kind), name(saver().save(interface.getPath())) {}
 
@@ -2253,10 +2291,11 @@ loadArchiveMember(MemoryBufferRef mb, uint32_t modTime, StringRef archiveName,
   }
 }
 
-Error ArchiveFile::fetch(const object::Archive::Child &c, StringRef reason) {
+Error ArchiveFile::fetch(const object::Archive::Child &c, StringRef reason,
+                         std::optional<MemoryBufferRef> mb) {
   if (!seen.insert(c.getChildOffset()).second)
     return Error::success();
-  auto file = childToObjectFile(c, /*lazy=*/false);
+  auto file = childToObjectFile(c, /*lazy=*/false, mb);
   if (!file)
     return file.takeError();
 
@@ -2285,10 +2324,13 @@ void ArchiveFile::fetch(const object::Archive::Symbol &sym) {
 
 Expected<InputFile *>
 ArchiveFile::childToObjectFile(const llvm::object::Archive::Child &c,
-                               bool lazy) {
-  Expected<MemoryBufferRef> mb = c.getMemoryBufferRef();
-  if (!mb)
-    return mb.takeError();
+                               bool lazy, std::optional<MemoryBufferRef> mb) {
+  if (!mb) {
+    Expected<MemoryBufferRef> mbOrErr = c.getMemoryBufferRef();
+    if (!mbOrErr)
+      return mbOrErr.takeError();
+    mb = *mbOrErr;
+  }
 
   Expected<TimePoint<std::chrono::seconds>> modTime = c.getLastModified();
   if (!modTime)
@@ -291,14 +291,17 @@ public:
   void addLazySymbols();
   void fetch(const llvm::object::Archive::Symbol &);
   // LLD normally doesn't use Error for error-handling, but the underlying
-  // Archive library does, so this is the cleanest way to wrap it.
-  Error fetch(const llvm::object::Archive::Child &, StringRef reason);
+  // Archive library does, so this is the cleanest way to wrap it. If the
+  // caller already opened the member, its buffer can be passed as \p mb.
+  Error fetch(const llvm::object::Archive::Child &, StringRef reason,
+              std::optional<llvm::MemoryBufferRef> mb = std::nullopt);
   const llvm::object::Archive &getArchive() const { return *file; };
   static bool classof(const InputFile *f) { return f->kind() == ArchiveKind; }
 
 private:
-  Expected<InputFile *> childToObjectFile(const llvm::object::Archive::Child &c,
-                                          bool lazy);
+  Expected<InputFile *>
+  childToObjectFile(const llvm::object::Archive::Child &c, bool lazy,
+                    std::optional<llvm::MemoryBufferRef> mb = std::nullopt);
   std::unique_ptr<llvm::object::Archive> file;
   // Keep track of children fetched from the archive by tracking
   // which address offsets have been fetched already.
@@ -325,9 +328,15 @@ private:
 
 extern llvm::SetVector<InputFile *> inputFiles;
 extern llvm::DenseMap<llvm::CachedHashStringRef, MemoryBufferRef> cachedReads;
+// Files opened ahead of time by prefetchFiles(). readFile() takes ownership of
+// an entry when the file is requested.
+extern llvm::DenseMap<llvm::CachedHashStringRef,
+                      std::unique_ptr<llvm::MemoryBuffer>>
+    prefetchedBuffers;
 extern llvm::SmallVector<StringRef> unprocessedLCLinkerOptions;
 
 std::optional<MemoryBufferRef> readFile(StringRef path);
+void prefetchFiles(ArrayRef<StringRef> paths);
 
 void extract(InputFile &file, StringRef reason);
 
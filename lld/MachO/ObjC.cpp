@@ -18,6 +18,7 @@
 #include "lld/Common/ErrorHandler.h"
 #include "llvm/ADT/DenseMap.h"
 #include "llvm/Bitcode/BitcodeReader.h"
+#include "llvm/Support/Parallel.h"
 #include "llvm/Support/TimeProfiler.h"
 
 using namespace llvm;
@@ -422,8 +423,12 @@ public:
 private:
   DenseSet<const Symbol *> collectNlCategories();
   void collectAndValidateCategoriesData();
-  bool
-  mergeCategoriesIntoSingleCategory(std::vector<InfoInputCategory> &categories);
+  bool parseCategoriesToExtInfo(const Symbol *baseClass,
+                                ArrayRef<InfoInputCategory> categories,
+                                ClassExtensionInfo &extInfo);
+  void
+  mergeCategoriesIntoSingleCategory(std::vector<InfoInputCategory> &categories,
+                                    const ClassExtensionInfo &extInfo);
 
   void eraseISec(ConcatInputSection *isec);
   void eraseMergedCategories();
@@ -473,8 +478,9 @@ private:
                                      uint32_t offset);
   Defined *getClassRo(const Defined *classSym, bool getMetaRo);
   SourceLanguage getClassSymSourceLang(const Defined *classSym);
-  bool mergeCategoriesIntoBaseClass(const Defined *baseClass,
-                                    std::vector<InfoInputCategory> &categories);
+  void mergeCategoriesIntoBaseClass(const Defined *baseClass,
+                                    std::vector<InfoInputCategory> &categories,
+                                    ClassExtensionInfo &extInfo);
   void eraseSymbolAtIsecOffset(ConcatInputSection *isec, uint32_t offset);
   void tryEraseDefinedAtIsecOffset(const ConcatInputSection *isec,
                                    uint32_t offset);
@@ -1111,17 +1117,28 @@ Defined *ObjcCategoryMerger::emitCategory(const ClassExtensionInfo &extInfo) {
   return catBodySym;
 }
 
-// This method merges all the categories (sharing a base class) into a single
-// category.
-bool ObjcCategoryMerger::mergeCategoriesIntoSingleCategory(
-    std::vector<InfoInputCategory> &categories) {
-  assert(categories.size() > 1 && "Expected at least 2 categories");
-
-  ClassExtensionInfo extInfo(catLayout);
+// Parse all the categories extending baseClass into extInfo. This only reads
+// input sections, so it may be run for several classes concurrently.
+bool ObjcCategoryMerger::parseCategoriesToExtInfo(
+    const Symbol *baseClass, ArrayRef<InfoInputCategory> categories,
+    ClassExtensionInfo &extInfo) {
+  if (auto *baseClassDef = dyn_cast<Defined>(baseClass)) {
+    extInfo.baseClass = baseClassDef;
+    extInfo.baseClassSourceLanguage = getClassSymSourceLang(baseClassDef);
+  }
 
-  for (auto &catInfo : categories)
+  for (const InfoInputCategory &catInfo : categories)
     if (!parseCatInfoToExtInfo(catInfo, extInfo))
       return false;
+  return true;
+}
+
+// This method merges all the categories (sharing a base class) into a single
+// category.
+void ObjcCategoryMerger::mergeCategoriesIntoSingleCategory(
+    std::vector<InfoInputCategory> &categories,
+    const ClassExtensionInfo &extInfo) {
+  assert(categories.size() > 1 && "Expected at least 2 categories");
 
   Defined *newCatDef = emitCategory(extInfo);
   assert(newCatDef && "Failed to create a new category");
@@ -1131,8 +1148,6 @@ bool ObjcCategoryMerger::mergeCategoriesIntoSingleCategory(
 
   for (auto &catInfo : categories)
     catInfo.wasMerged = true;
-
-  return true;
 }
 
 void ObjcCategoryMerger::createSymbolReference(Defined *refFrom,
@@ -1335,18 +1350,32 @@ void ObjcCategoryMerger::eraseMergedCategories() {
 void ObjcCategoryMerger::doMerge() {
   collectAndValidateCategoriesData();
 
-  for (auto &[baseClass, catInfos] : categoryMap) {
-    bool merged = false;
+  // Parsing the categories of a class only reads input data, so it is done for
+  // all classes in parallel. Emitting the merged data creates new sections and
+  // symbols, and stays serial in categoryMap order.
+  std::vector<ClassExtensionInfo> extInfos(categoryMap.size(),
+                                           ClassExtensionInfo(catLayout));
+  std::vector<uint8_t> parsed(categoryMap.size());
+  parallelFor(0, categoryMap.size(), [&](size_t i) {
+    auto &[baseClass, catInfos] = *(categoryMap.begin() + i);
+    if (isa<Defined>(baseClass) || catInfos.size() > 1)
+      parsed[i] = parseCategoriesToExtInfo(baseClass, catInfos, extInfos[i]);
+  });
+
+  for (auto [i, entry] : llvm::enumerate(categoryMap)) {
+    auto &[baseClass, catInfos] = entry;
+    if (!parsed[i]) {
+      warn("ObjC category merging skipped for class symbol' " +
+           baseClass->getName().str() + "'\n");
+      continue;
+    }
     if (auto *baseClassDef = dyn_cast<Defined>(baseClass)) {
       // Merge all categories into the base class
-      merged = mergeCategoriesIntoBaseClass(baseClassDef, catInfos);
-    } else if (catInfos.size() > 1) {
+      mergeCategoriesIntoBaseClass(baseClassDef, catInfos, extInfos[i]);
+    } else {
       // Merge all categories into a new, single category
-      merged = mergeCategoriesIntoSingleCategory(catInfos);
+      mergeCategoriesIntoSingleCategory(catInfos, extInfos[i]);
     }
-    if (!merged)
-      warn("ObjC category merging skipped for class symbol' " +
-           baseClass->getName().str() + "'\n");
   }
 
   // Erase all categories that were merged
@@ -1406,18 +1435,12 @@ ObjcCategoryMerger::getClassSymSourceLang(const Defined *classSym) {
   llvm_unreachable("Unexpected class symbol name during category merging");
 }
 
-bool ObjcCategoryMerger::mergeCategoriesIntoBaseClass(
-    const Defined *baseClass, std::vector<InfoInputCategory> &categories) {
+void ObjcCategoryMerger::mergeCategoriesIntoBaseClass(
+    const Defined *baseClass, std::vector<InfoInputCategory> &categories,
+    ClassExtensionInfo &extInfo) {
   assert(categories.size() >= 1 && "Expected at least one category to merge");
-
-  // Collect all the info from the categories
-  ClassExtensionInfo extInfo(catLayout);
-  extInfo.baseClass = baseClass;
-  extInfo.baseClassSourceLanguage = getClassSymSourceLang(baseClass);
-
-  for (auto &catInfo : categories)
-    if (!parseCatInfoToExtInfo(catInfo, extInfo))
-      return false;
+  assert(extInfo.baseClass == baseClass &&
+         "Expected the categories to have been parsed already");
 
   // Get metadata for the base class
   Defined *metaRo = getClassRo(baseClass, /*getMetaRo=*/true);
@@ -1484,8 +1507,6 @@ bool ObjcCategoryMerger::mergeCategoriesIntoBaseClass(
   // Mark all the categories as merged - this will be used to erase them later
   for (auto &catInfo : categories)
     catInfo.wasMerged = true;
-
-  return true;
 }
 
 // Erase the symbol at a given offset in an InputSection
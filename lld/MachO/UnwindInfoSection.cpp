@@ -471,55 +471,54 @@ void UnwindInfoSectionImpl::finalize() {
   // vector of indices to entries and sort & fold that instead.
   cuIndices.resize(cuEntries.size());
   std::iota(cuIndices.begin(), cuIndices.end(), 0);
-  llvm::sort(cuIndices, [&](size_t a, size_t b) {
-    return cuEntries[a].functionAddress < cuEntries[b].functionAddress;
+  parallelSort(cuIndices, [&](size_t a, size_t b) {
+    return std::tie(cuEntries[a].functionAddress, a) <
+           std::tie(cuEntries[b].functionAddress, b);
   });
 
   // Record the ending boundary before we fold the entries.
   cueEndBoundary = cuEntries[cuIndices.back()].functionAddress +
                    cuEntries[cuIndices.back()].functionLength;
 
-  // Fold adjacent entries with matching encoding+personality and without LSDA
-  // We use three iterators on the same cuIndices to fold in-situ:
-  // (1) `foldBegin` is the first of a potential sequence of matching entries
-  // (2) `foldEnd` is the first non-matching entry after `foldBegin`.
-  // The semi-open interval [ foldBegin .. foldEnd ) contains a range
-  // entries that can be folded into a single entry and written to ...
-  // (3) `foldWrite`
+  // Fold adjacent entries with matching encoding+personality and without LSDA.
+  // An entry folds into the run before it iff it matches its immediate
+  // predecessor, so the per-entry decision is computed in parallel and the
+  // surviving indices are then compacted in-situ.
+  //
+  // Common LSDA encodings (e.g. for C++ and Objective-C) contain offsets from
+  // a base address. The base address is normally not contained directly in
+  // the LSDA, and in that case, the personality function treats the starting
+  // address of the function (which is computed by the unwinder) as the base
+  // address and interprets the LSDA accordingly. The unwinder computes the
+  // starting address of a function as the address associated with its CU
+  // entry. For this reason, we cannot fold adjacent entries if they have an
+  // LSDA, because folding would make the unwinder compute the wrong starting
+  // address for the functions with the folded entries, which in turn would
+  // cause the personality function to misinterpret the LSDA for those
+  // functions. In the very rare case where the base address is encoded
+  // directly in the LSDA, two functions at different addresses would
+  // necessarily have different LSDAs, so their CU entries would not have been
+  // folded anyway.
+  std::vector<uint8_t> folded(cuIndices.size());
+  parallelFor(1, cuIndices.size(), [&](size_t i) {
+    const CompactUnwindEntry &prev = cuEntries[cuIndices[i - 1]];
+    const CompactUnwindEntry &cur = cuEntries[cuIndices[i]];
+    folded[i] = prev.encoding == cur.encoding && !prev.lsda && !cur.lsda &&
+                // If we've gotten to this point, we don't have an LSDA, which
+                // should also imply that we don't have a personality function,
+                // since in all likelihood a personality function needs the
+                // LSDA to do anything useful. It can be technically valid to
+                // have a personality function and no LSDA though (e.g. the C++
+                // personality __gxx_personality_v0 is just a no-op without
+                // LSDA), so we still check for personality function
+                // equivalence to handle that case.
+                prev.personality == cur.personality &&
+                canFoldEncoding(cur.encoding);
+  });
   auto foldWrite = cuIndices.begin();
-  for (auto foldBegin = cuIndices.begin(); foldBegin < cuIndices.end();) {
-    auto foldEnd = foldBegin;
-    // Common LSDA encodings (e.g. for C++ and Objective-C) contain offsets from
-    // a base address. The base address is normally not contained directly in
-    // the LSDA, and in that case, the personality function treats the starting
-    // address of the function (which is computed by the unwinder) as the base
-    // address and interprets the LSDA accordingly. The unwinder computes the
-    // starting address of a function as the address associated with its CU
-    // entry. For this reason, we cannot fold adjacent entries if they have an
-    // LSDA, because folding would make the unwinder compute the wrong starting
-    // address for the functions with the folded entries, which in turn would
-    // cause the personality function to misinterpret the LSDA for those
-    // functions. In the very rare case where the base address is encoded
-    // directly in the LSDA, two functions at different addresses would
-    // necessarily have different LSDAs, so their CU entries would not have been
-    // folded anyway.
-    while (++foldEnd < cuIndices.end() &&
-           cuEntries[*foldBegin].encoding == cuEntries[*foldEnd].encoding &&
-           !cuEntries[*foldBegin].lsda && !cuEntries[*foldEnd].lsda &&
-           // If we've gotten to this point, we don't have an LSDA, which should
-           // also imply that we don't have a personality function, since in all
-           // likelihood a personality function needs the LSDA to do anything
-           // useful. It can be technically valid to have a personality function
-           // and no LSDA though (e.g. the C++ personality __gxx_personality_v0
-           // is just a no-op without LSDA), so we still check for personality
-           // function equivalence to handle that case.
-           cuEntries[*foldBegin].personality ==
-               cuEntries[*foldEnd].personality &&
-           canFoldEncoding(cuEntries[*foldEnd].encoding))
-      ;
-    *foldWrite++ = *foldBegin;
-    foldBegin = foldEnd;
-  }
+  for (size_t i = 0, e = cuIndices.size(); i != e; ++i)
+    if (!folded[i])
+      *foldWrite++ = cuIndices[i];
   cuIndices.erase(foldWrite, cuIndices.end());
 
   encodePersonalities();
@@ -690,9 +689,12 @@ void UnwindInfoSectionImpl::writeTo(uint8_t *buf) const {
     lep++;
   }
 
-  // Level-2 pages
-  auto *pp = reinterpret_cast<uint32_t *>(lep);
-  for (const SecondLevelPage &page : secondLevelPages) {
+  // Level-2 pages. Each page occupies its own fixed-size slot, so they can be
+  // encoded independently.
+  auto *pagesBegin = reinterpret_cast<uint32_t *>(lep);
+  parallelFor(0, secondLevelPages.size(), [&](size_t pageIdx) {
+    const SecondLevelPage &page = secondLevelPages[pageIdx];
+    uint32_t *pp = pagesBegin + pageIdx * SECOND_LEVEL_PAGE_WORDS;
     if (page.kind == UNWIND_SECOND_LEVEL_COMPRESSED) {
       uintptr_t functionAddressBase =
           cuEntries[cuIndices[page.entryIndex]].functionAddress;
@@ -734,8 +736,7 @@ void UnwindInfoSectionImpl::writeTo(uint8_t *buf) const {
         *ep++ = cue.encoding;
       }
     }
-    pp += SECOND_LEVEL_PAGE_WORDS;
-  }
+  });
 }
 
 UnwindInfoSection *macho::makeUnwindInfoSection() {
@@ -0,0 +1,60 @@
+# Check that --icf=all folds identical functions from different object files,
+# even though the placeholder values of their relocations differ.
+
+# RUN: split-file %s %t
+# RUN: llvm-mc -filetype=obj -triple=wasm32-unknown-unknown %t/a.s -o %t/a.o
+# RUN: llvm-mc -filetype=obj -triple=wasm32-unknown-unknown %t/b.s -o %t/b.o
+# RUN: wasm-ld --no-entry --export=foo --export=bar --icf=all --verbose \
+# RUN:   %t/a.o %t/b.o -o %t.wasm 2>&1 | FileCheck --check-prefix=LOG %s
+# RUN: obj2yaml %t.wasm | FileCheck %s
+# RUN: wasm-ld --no-entry --export=foo --export=bar %t/a.o %t/b.o \
+# RUN:   -o %t.noicf.wasm
+# RUN: obj2yaml %t.noicf.wasm | FileCheck --check-prefix=NOICF %s
+
+# LOG: icf: folded 1 of 3 functions into 2 classes
+
+# CHECK:       - Type:            EXPORT
+# CHECK:           - Name:            foo
+# CHECK-NEXT:        Kind:            FUNCTION
+# CHECK-NEXT:        Index:           [[FOO:[0-9]+]]
+# CHECK-NEXT:      - Name:            bar
+# CHECK-NEXT:        Kind:            FUNCTION
+# CHECK-NEXT:        Index:           [[FOO]]
+
+# NOICF:       - Type:            EXPORT
+# NOICF:           - Name:            foo
+# NOICF-NEXT:        Kind:            FUNCTION
+# NOICF-NEXT:        Index:           [[FOO:[0-9]+]]
+# NOICF-NEXT:      - Name:            bar
+# NOICF-NEXT:        Kind:            FUNCTION
+# NOICF-NOT:         Index:           [[FOO]]
+
+#--- a.s
+# In a.o, the call to target uses function index 1.
+  .functype target (i32) -> (i32)
+
+  .globl foo
+foo:
+  .functype foo (i32) -> (i32)
+  local.get 0
+  call target
+  end_function
+
+  .globl target
+target:
+  .functype target (i32) -> (i32)
+  local.get 0
+  i32.const 1
+  i32.add
+  end_function
+
+#--- b.s
+# In b.o, target is imported, so the call uses function index 0.
+  .functype target (i32) -> (i32)
+
+  .globl bar
+bar:
+  .functype bar (i32) -> (i32)
+  local.get 0
+  call target
+  end_function
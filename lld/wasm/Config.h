@@ -63,6 +63,7 @@ struct Config {
   bool extendedConst;
   bool growableTable;
   bool gcSections;
+  bool icf;
   llvm::StringSet<> keepSections;
   std::optional<std::pair<llvm::StringRef, llvm::StringRef>> memoryImport;
   std::optional<llvm::StringRef> memoryExport;
@@ -8,6 +8,7 @@
 
 #include "lld/Common/Driver.h"
 #include "Config.h"
+#include "ICF.h"
 #include "InputChunks.h"
 #include "InputElement.h"
 #include "MarkLive.h"
@@ -582,6 +583,7 @@ static void readConfigs(opt::InputArgList &args) {
   ctx.arg.rpath = args::getStrings(args, OPT_rpath);
   ctx.arg.gcSections =
       args.hasFlag(OPT_gc_sections, OPT_no_gc_sections, !ctx.arg.relocatable);
+  ctx.arg.icf = args.hasFlag(OPT_icf_all, OPT_icf_none, false);
   for (auto *arg : args.filtered(OPT_keep_section))
     ctx.arg.keepSections.insert(arg->getValue());
   ctx.arg.mergeDataSegments =
@@ -785,6 +787,8 @@ static void checkOptions(opt::InputArgList &args) {
       error("entry point specified for relocatable output file");
     if (ctx.arg.gcSections)
       error("-r and --gc-sections may not be used together");
+    if (ctx.arg.icf)
+      error("-r and --icf may not be used together");
     if (ctx.arg.compressRelocations)
       error("-r -and --compress-relocations may not be used together");
     if (args.hasArg(OPT_undefined))
@@ -1487,8 +1491,10 @@ void LinkerDriver::linkerMain(ArrayRef<const char *> argsArr) {
   // Any remaining lazy symbols should be demoted to Undefined
   demoteLazySymbols();
 
-  // Do size optimizations: garbage collection
+  // Do size optimizations: garbage collection and identical code folding
   markLive();
+  if (ctx.arg.icf)
+    doIcf();
 
   // Provide the indirect function table if needed.
   ctx.sym.indirectFunctionTable =
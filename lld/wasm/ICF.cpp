@@ -0,0 +1,315 @@
+//===- ICF.cpp ------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements --icf=all, which folds defined functions that are
+// identical into a single function.
+//
+// Two functions are identical if they have the same signature, the same body
+// apart from the bytes patched by relocations, and the same relocations, where
+// relocations are equal if they have the same type, offset and addend and
+// refer to the same target. Relocations that refer to other candidate
+// functions compare the equivalence classes of the targets instead, so that
+// e.g. two functions that only call two different but identical functions can
+// be folded as well.
+//
+// As in lld/ELF/ICF.cpp, the equivalence classes are computed as a fixed point
+// of partition refinement: functions are first partitioned by their contents,
+// and classes are then repeatedly split by the classes of their relocation
+// targets until no class is split anymore. Hashes are only used to find
+// potential matches quickly; membership is always decided by an exact
+// comparison, so the result does not depend on hash values.
+//
+// Folded functions are marked dead, and every symbol that referred to one of
+// them is redirected to the first function of its class in input order, so
+// the folded functions get no function index or table slot of their own.
+//
+//===----------------------------------------------------------------------===//
+
+#include "ICF.h"
+#include "Config.h"
+#include "InputChunks.h"
+#include "InputFiles.h"
+#include "SymbolTable.h"
+#include "Symbols.h"
+#include "lld/Common/ErrorHandler.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/Hashing.h"
+#include "llvm/Support/Parallel.h"
+#include "llvm/Support/xxhash.h"
+#include <numeric>
+
+#define DEBUG_TYPE "lld"
+
+using namespace llvm;
+using namespace llvm::wasm;
+
+namespace lld::wasm {
+
+namespace {
+
+class ICF {
+public:
+  void run();
+
+private:
+  bool split(ArrayRef<uint64_t> hashes,
+             function_ref<bool(uint32_t, uint32_t)> eq);
+  uint64_t getTargetKey(const InputFunction *func,
+                        const WasmRelocation &rel) const;
+  void fold();
+
+  // Candidate functions in input order.
+  SmallVector<InputFunction *, 0> funcs;
+  DenseMap<const InputFunction *, uint32_t> funcIndex;
+
+  // Equivalence class of each candidate.
+  SmallVector<uint32_t, 0> classes;
+  uint32_t numClasses = 0;
+};
+
+} // namespace
+
+// Synthetic functions have no input body to compare, and functions with an
+// explicit export name must keep their own function index.
+static bool isEligible(const InputFunction *func) {
+  return func->live && func->file && !isa<SyntheticFunction>(func) &&
+         !func->getExportName();
+}
+
+// Returns the number of bytes that a relocation of the given type patches in
+// a function body. LEB and SLEB relocations are padded to their maximum width.
+static unsigned getRelocSize(uint8_t type) {
+  switch (type) {
+  case R_WASM_TABLE_INDEX_I32:
+  case R_WASM_MEMORY_ADDR_I32:
+  case R_WASM_FUNCTION_OFFSET_I32:
+  case R_WASM_SECTION_OFFSET_I32:
+  case R_WASM_GLOBAL_INDEX_I32:
+  case R_WASM_MEMORY_ADDR_LOCREL_I32:
+  case R_WASM_FUNCTION_INDEX_I32:
+    return 4;
+  case R_WASM_MEMORY_ADDR_I64:
+  case R_WASM_TABLE_INDEX_I64:
+  case R_WASM_FUNCTION_OFFSET_I64:
+    return 8;
+  case R_WASM_MEMORY_ADDR_LEB64:
+  case R_WASM_MEMORY_ADDR_SLEB64:
+  case R_WASM_MEMORY_ADDR_REL_SLEB64:
+  case R_WASM_TABLE_INDEX_SLEB64:
+  case R_WASM_TABLE_INDEX_REL_SLEB64:
+  case R_WASM_MEMORY_ADDR_TLS_SLEB64:
+    return 10;
+  default:
+    return 5;
+  }
+}
+
+// Calls fn(begin, end) for each range of the body of func that is not patched
+// by a relocation. Relocation sites hold object-local placeholder values, such
+// as the function index of the callee in the object file, so they must not be
+// hashed or compared. The relocation targets are compared separately.
+template <typename Fn>
+static void forEachUnrelocatedRange(const InputFunction *func, Fn fn) {
+  size_t size = func->data().size();
+  size_t pos = 0;
+  for (const WasmRelocation &rel : func->getRelocations()) {
+    size_t off = std::min<size_t>(rel.Offset - func->getInputSectionOffset(),
+                                  size);
+    if (off > pos)
+      fn(pos, off);
+    pos = std::max(pos, std::min<size_t>(off + getRelocSize(rel.Type), size));
+  }
+  if (pos < size)
+    fn(pos, size);
+}
+
+static uint64_t getShapeHash(const InputFunction *func) {
+  const WasmSignature &sig = func->signature;
+  ArrayRef<uint8_t> data = func->data();
+  hash_code h = hash_combine(
+      data.size(), hash_combine_range(sig.Returns.begin(), sig.Returns.end()),
+      hash_combine_range(sig.Params.begin(), sig.Params.end()));
+  forEachUnrelocatedRange(func, [&](size_t begin, size_t end) {
+    h = hash_combine(h, xxh3_64bits(data.slice(begin, end - begin)));
+  });
+  for (const WasmRelocation &rel : func->getRelocations())
+    h = hash_combine(h, rel.Type, rel.Offset - func->getInputSectionOffset(),
+                     rel.Addend);
+  return h;
+}
+
+// Compare everything but the relocation targets.
+static bool equalsShape(const InputFunction *a, const InputFunction *b) {
+  if (a->signature != b->signature || a->data().size() != b->data().size())
+    return false;
+  ArrayRef<WasmRelocation> ra = a->getRelocations();
+  ArrayRef<WasmRelocation> rb = b->getRelocations();
+  if (ra.size() != rb.size())
+    return false;
+  ArrayRef<WasmSignature> typesA = a->file->getWasmObj()->types();
+  ArrayRef<WasmSignature> typesB = b->file->getWasmObj()->types();
+  for (size_t i = 0, e = ra.size(); i != e; ++i) {
+    if (ra[i].Type != rb[i].Type ||
+        ra[i].Offset - a->getInputSectionOffset() !=
+            rb[i].Offset - b->getInputSectionOffset() ||
+        ra[i].Addend != rb[i].Addend)
+      return false;
+    if (ra[i].Type == R_WASM_TYPE_INDEX_LEB &&
+        typesA[ra[i].Index] != typesB[rb[i].Index])
+      return false;
+  }
+
+  // The relocations are at the same offsets in both bodies, so the ranges
+  // between them are the same as well.
+  ArrayRef<uint8_t> da = a->data();
+  ArrayRef<uint8_t> db = b->data();
+  bool equal = true;
+  forEachUnrelocatedRange(a, [&](size_t begin, size_t end) {
+    if (equal)
+      equal = da.slice(begin, end - begin) == db.slice(begin, end - begin);
+  });
+  return equal;
+}
+
+// Returns a value identifying the target of a relocation. Candidate functions
+// are identified by their current equivalence class, which is tagged with the
+// top bit to keep it apart from the addresses used for other targets.
+uint64_t ICF::getTargetKey(const InputFunction *func,
+                           const WasmRelocation &rel) const {
+  // Type indices have been compared by equalsShape().
+  if (rel.Type == R_WASM_TYPE_INDEX_LEB)
+    return 0;
+  Symbol *sym = func->file->getSymbols()[rel.Index];
+  if (auto *f = dyn_cast<DefinedFunction>(sym)) {
+    auto it = funcIndex.find(f->function);
+    if (it != funcIndex.end())
+      return (uint64_t(1) << 63) | classes[it->second];
+    return reinterpret_cast<uintptr_t>(f->function);
+  }
+  return reinterpret_cast<uintptr_t>(sym);
+}
+
+// Splits every equivalence class so that two functions stay in the same class
+// only if `eq` holds for them. Functions of a class are only compared if their
+// hashes match. Returns true if any class was split.
+bool ICF::split(ArrayRef<uint64_t> hashes,
+                function_ref<bool(uint32_t, uint32_t)> eq) {
+  SmallVector<uint32_t, 0> order(funcs.size());
+  std::iota(order.begin(), order.end(), 0);
+  parallelSort(order, [&](uint32_t a, uint32_t b) {
+    return std::tie(classes[a], hashes[a], a) <
+           std::tie(classes[b], hashes[b], b);
+  });
+
+  SmallVector<uint32_t, 0> newClasses(funcs.size());
+  SmallVector<uint32_t, 4> leaders;
+  uint32_t n = 0;
+  for (size_t begin = 0, end; begin != order.size(); begin = end) {
+    uint32_t first = order[begin];
+    for (end = begin + 1; end != order.size(); ++end)
+      if (classes[order[end]] != classes[first] ||
+          hashes[order[end]] != hashes[first])
+        break;
+
+    leaders.clear();
+    for (uint32_t i : ArrayRef(order).slice(begin, end - begin)) {
+      auto it = llvm::find_if(leaders, [&](uint32_t l) { return eq(l, i); });
+      if (it == leaders.end()) {
+        leaders.push_back(i);
+        newClasses[i] = n++;
+      } else {
+        newClasses[i] = newClasses[*it];
+      }
+    }
+  }
+
+  bool changed = n != numClasses;
+  classes = std::move(newClasses);
+  numClasses = n;
+  return changed;
+}
+
+void ICF::fold() {
+  // Keep the first function of each class in input order.
+  SmallVector<InputFunction *, 0> leader(numClasses);
+  SmallVector<InputFunction *, 0> replacement(funcs.size());
+  size_t numFolded = 0;
+  for (auto [i, func] : llvm::enumerate(funcs)) {
+    InputFunction *&l = leader[classes[i]];
+    if (!l) {
+      l = func;
+      continue;
+    }
+    LLVM_DEBUG(dbgs() << "icf: folding " << toString(func) << " into "
+                      << toString(l) << "\n");
+    replacement[i] = l;
+    func->live = false;
+    ++numFolded;
+  }
+  if (!numFolded)
+    return;
+
+  auto redirect = [&](Symbol *sym) {
+    auto *f = dyn_cast_or_null<DefinedFunction>(sym);
+    if (!f)
+      return;
+    auto it = funcIndex.find(f->function);
+    if (it != funcIndex.end() && replacement[it->second])
+      f->function = replacement[it->second];
+  };
+  for (ObjFile *file : ctx.objectFiles)
+    for (Symbol *sym : file->getSymbols())
+      redirect(sym);
+  for (Symbol *sym : symtab->symbols())
+    redirect(sym);
+
+  log("icf: folded " + Twine(numFolded) + " of " + Twine(funcs.size()) +
+      " functions into " + Twine(numClasses) + " classes");
+}
+
+void ICF::run() {
+  for (ObjFile *file : ctx.objectFiles)
+    for (InputFunction *func : file->functions)
+      if (isEligible(func)) {
+        funcIndex[func] = funcs.size();
+        funcs.push_back(func);
+      }
+  if (funcs.size() < 2)
+    return;
+
+  classes.resize(funcs.size());
+  numClasses = 1;
+
+  // Partition by contents.
+  SmallVector<uint64_t, 0> hashes(funcs.size());
+  parallelFor(0, funcs.size(),
+              [&](size_t i) { hashes[i] = getShapeHash(funcs[i]); });
+  split(hashes, [&](uint32_t a, uint32_t b) {
+    return equalsShape(funcs[a], funcs[b]);
+  });
+
+  // Refine by relocation targets until the classes are stable.
+  std::vector<SmallVector<uint64_t, 0>> keys(funcs.size());
+  do {
+    parallelFor(0, funcs.size(), [&](size_t i) {
+      const InputFunction *func = funcs[i];
+      SmallVector<uint64_t, 0> &k = keys[i];
+      k.clear();
+      for (const WasmRelocation &rel : func->getRelocations())
+        k.push_back(getTargetKey(func, rel));
+      hashes[i] = hash_combine_range(k.begin(), k.end());
+    });
+  } while (split(hashes,
+                 [&](uint32_t a, uint32_t b) { return keys[a] == keys[b]; }));
+
+  fold();
+}
+
+void doIcf() { ICF().run(); }
+
+} // namespace lld::wasm
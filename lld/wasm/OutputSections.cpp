@@ -16,6 +16,7 @@
 #include "lld/Common/Memory.h"
 #include "llvm/ADT/Twine.h"
 #include "llvm/Support/LEB128.h"
+#include "llvm/Support/Parallel.h"
 
 #define DEBUG_TYPE "lld"
 
@@ -62,7 +63,9 @@ void CodeSection::finalizeContents() {
   createHeader(bodySize);
 }
 
-void CodeSection::writeTo(uint8_t *buf) {
+// Writes the section and code section headers, and returns the position that
+// the offsets of the function bodies are relative to.
+uint8_t *CodeSection::writeHeaders(uint8_t *buf) {
   log("writing " + toString(*this) + " offset=" + Twine(offset) +
       " size=" + Twine(getSize()));
   log(" headersize=" + Twine(header.size()));
@@ -75,12 +78,37 @@ void CodeSection::writeTo(uint8_t *buf) {
 
   // Write code section headers
   memcpy(buf, codeSectionHeader.data(), codeSectionHeader.size());
+  return buf;
+}
+
+void CodeSection::writeTo(uint8_t *buf) {
+  buf = writeHeaders(buf);
 
   // Write code section bodies
   for (const InputChunk *chunk : functions)
     chunk->writeTo(buf);
 }
 
+// Like writeTo(), but spawns the function bodies onto `tg` in batches of
+// roughly equal size. Every function has its final offset assigned by
+// finalizeContents(), so the batches write disjoint ranges of the output.
+void CodeSection::writeTo(uint8_t *buf, parallel::TaskGroup &tg) {
+  buf = writeHeaders(buf);
+
+  const size_t taskSizeLimit = 4 << 20;
+  for (size_t begin = 0, i = 0, taskSize = 0, e = functions.size(); i != e;) {
+    taskSize += functions[i]->getSize();
+    if (++i == e || taskSize >= taskSizeLimit) {
+      tg.spawn([=] {
+        for (const InputChunk *chunk : functions.slice(begin, i - begin))
+          chunk->writeTo(buf);
+      });
+      begin = i;
+      taskSize = 0;
+    }
+  }
+}
+
 uint32_t CodeSection::getNumRelocations() const {
   uint32_t count = 0;
   for (const InputChunk *func : functions)
@@ -15,6 +15,10 @@
 #include "lld/Common/LLVM.h"
 #include "llvm/ADT/DenseMap.h"
 
+namespace llvm::parallel {
+class TaskGroup;
+} // namespace llvm::parallel
+
 namespace lld {
 
 namespace wasm {
@@ -65,6 +69,7 @@ public:
 
   size_t getSize() const override { return header.size() + bodySize; }
   void writeTo(uint8_t *buf) override;
+  void writeTo(uint8_t *buf, llvm::parallel::TaskGroup &tg);
   uint32_t getNumRelocations() const override;
   void writeRelocations(raw_ostream &os) const override;
   bool isNeeded() const override { return functions.size() > 0; }
@@ -73,6 +78,8 @@ public:
   ArrayRef<InputFunction *> functions;
 
 protected:
+  uint8_t *writeHeaders(uint8_t *buf);
+
   std::string codeSectionHeader;
   size_t bodySize = 0;
 };
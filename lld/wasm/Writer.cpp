@@ -219,10 +219,16 @@ void Writer::writeHeader() {
 
 void Writer::writeSections() {
   uint8_t *buf = buffer->getBufferStart();
-  parallelForEach(outputSections, [buf](OutputSection *s) {
+  // The code section is usually by far the largest, so split it into several
+  // tasks rather than writing it from a single thread.
+  parallel::TaskGroup tg;
+  for (OutputSection *s : outputSections) {
     assert(s->isNeeded());
-    s->writeTo(buf);
-  });
+    if (auto *code = dyn_cast<CodeSection>(s))
+      code->writeTo(buf, tg);
+    else
+      tg.spawn([=] { s->writeTo(buf); });
+  }
 }
 
 // Computes a hash value of Data using a given hash function.
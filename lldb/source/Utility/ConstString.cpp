@@ -79,9 +79,11 @@ public:
 
   StringPoolValueType GetMangledCounterpart(const char *ccstr) {
     if (ccstr != nullptr) {
-      const PoolEntry &pool = selectPool(llvm::StringRef(ccstr));
+      // The entry knows its own length, so there is no need for strlen.
+      const StringPoolEntryType &entry = GetStringMapEntryFromKeyData(ccstr);
+      const PoolEntry &pool = selectPool(entry.getKey());
       llvm::sys::SmartScopedReader<false> rlock(pool.m_mutex);
-      return GetStringMapEntryFromKeyData(ccstr).getValue();
+      return entry.getValue();
     }
     return nullptr;
   }
@@ -144,9 +146,10 @@ public:
     {
       // Now assign the demangled const string as the counterpart of the
       // mangled const string...
-      PoolEntry &pool = selectPool(llvm::StringRef(mangled_ccstr));
+      StringPoolEntryType &entry = GetStringMapEntryFromKeyData(mangled_ccstr);
+      PoolEntry &pool = selectPool(entry.getKey());
       llvm::sys::SmartScopedWriter<false> wlock(pool.m_mutex);
-      GetStringMapEntryFromKeyData(mangled_ccstr).setValue(demangled_ccstr);
+      entry.setValue(demangled_ccstr);
     }
 
     // Return the constant demangled C string
@@ -0,0 +1,138 @@
+//===- DenseMapBM.cpp - DenseMap benchmark --------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// Measures DenseMap with pointer keys, as used by analysis caches. Hashing a
+// pointer is cheap, so the cost is dominated by the cache misses of probing
+// the bucket array, by growing it, and by the tombstones that invalidation
+// leaves behind until the next rehash.
+//
+//===----------------------------------------------------------------------===//
+
+#include "benchmark/benchmark.h"
+#include "llvm/ADT/DenseMap.h"
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace llvm;
+
+namespace {
+// Stands in for the IR objects that pointer-keyed maps in analyses are keyed
+// by.
+struct Node {
+  uint64_t Data[4];
+};
+} // namespace
+
+// Returns pointers to NumNodes heap objects in random order, so that lookups
+// do not walk the table in allocation order.
+static std::vector<Node *> getKeys(std::vector<std::unique_ptr<Node>> &Storage,
+                                   size_t NumNodes) {
+  std::vector<Node *> Keys;
+  Keys.reserve(NumNodes);
+  for (size_t I = 0; I < NumNodes; ++I) {
+    Storage.push_back(std::make_unique<Node>());
+    Keys.push_back(Storage.back().get());
+  }
+  std::shuffle(Keys.begin(), Keys.end(), std::mt19937(0));
+  return Keys;
+}
+
+// With Reserve set, the table is sized up front, which separates the cost of
+// probing from the cost of rehashing while the table grows.
+template <bool Reserve>
+static void BM_DenseMapPointerInsert(benchmark::State &State) {
+  std::vector<std::unique_ptr<Node>> Storage;
+  std::vector<Node *> Keys = getKeys(Storage, State.range(0));
+  for (auto _ : State) {
+    DenseMap<Node *, unsigned> Map;
+    if (Reserve)
+      Map.reserve(Keys.size());
+    for (Node *Key : Keys)
+      Map.try_emplace(Key, 0);
+    benchmark::DoNotOptimize(Map.size());
+  }
+  State.SetItemsProcessed(State.iterations() * Keys.size());
+}
+
+static void BM_DenseMapPointerLookupHit(benchmark::State &State) {
+  std::vector<std::unique_ptr<Node>> Storage;
+  std::vector<Node *> Keys = getKeys(Storage, State.range(0));
+  DenseMap<Node *, unsigned> Map;
+  for (Node *Key : Keys)
+    Map.try_emplace(Key, 0);
+  std::shuffle(Keys.begin(), Keys.end(), std::mt19937(1));
+  for (auto _ : State)
+    for (Node *Key : Keys)
+      benchmark::DoNotOptimize(Map.find(Key));
+  State.SetItemsProcessed(State.iterations() * Keys.size());
+}
+
+// A miss probes until it reaches an empty bucket, so it is sensitive to how
+// full the table is and how long the probe chains are.
+static void BM_DenseMapPointerLookupMiss(benchmark::State &State) {
+  std::vector<std::unique_ptr<Node>> Storage;
+  std::vector<Node *> Keys = getKeys(Storage, State.range(0));
+  std::vector<Node *> Misses = getKeys(Storage, State.range(0));
+  DenseMap<Node *, unsigned> Map;
+  for (Node *Key : Keys)
+    Map.try_emplace(Key, 0);
+  for (auto _ : State)
+    for (Node *Key : Misses)
+      benchmark::DoNotOptimize(Map.find(Key));
+  State.SetItemsProcessed(State.iterations() * Misses.size());
+}
+
+// Analysis caches erase entries when the IR they describe changes, and add
+// entries for the new IR. Erased buckets become tombstones that lookups have
+// to probe past, and that are only reclaimed when an insertion happens to land
+// on one or triggers a rehash. Each iteration replaces one live key by a key
+// that is not in the map, so the number of entries stays constant.
+static void BM_DenseMapPointerReplace(benchmark::State &State) {
+  std::vector<std::unique_ptr<Node>> Storage;
+  std::vector<Node *> Live = getKeys(Storage, State.range(0));
+  std::vector<Node *> Dead = getKeys(Storage, State.range(0));
+  DenseMap<Node *, unsigned> Map;
+  for (Node *Key : Live)
+    Map.try_emplace(Key, 0);
+  size_t I = 0;
+  for (auto _ : State) {
+    Map.erase(Live[I]);
+    Map.try_emplace(Dead[I], 0);
+    benchmark::DoNotOptimize(Map.find(Live[(I + 1) % Live.size()]));
+    if (++I == Live.size()) {
+      std::swap(Live, Dead);
+      I = 0;
+    }
+  }
+  State.SetItemsProcessed(State.iterations());
+}
+
+BENCHMARK_TEMPLATE(BM_DenseMapPointerInsert, false)
+    ->Arg(1 << 10)
+    ->Arg(1 << 16)
+    ->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_DenseMapPointerInsert, true)
+    ->Arg(1 << 10)
+    ->Arg(1 << 16)
+    ->Arg(1 << 20);
+BENCHMARK(BM_DenseMapPointerLookupHit)
+    ->Arg(1 << 10)
+    ->Arg(1 << 16)
+    ->Arg(1 << 20);
+BENCHMARK(BM_DenseMapPointerLookupMiss)
+    ->Arg(1 << 10)
+    ->Arg(1 << 16)
+    ->Arg(1 << 20);
+BENCHMARK(BM_DenseMapPointerReplace)
+    ->Arg(1 << 10)
+    ->Arg(1 << 16)
+    ->Arg(1 << 20);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,103 @@
+//===- StringMapBM.cpp - StringMap benchmark ------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// Measures StringMap the way symbol tables use it. The keys are long mangled
+// names that share a prefix, so every probe that reaches a matching hash pays
+// for a full key comparison, and the names are mostly interned rather than
+// removed.
+//
+//===----------------------------------------------------------------------===//
+
+#include "benchmark/benchmark.h"
+#include "llvm/ADT/StringMap.h"
+#include <string>
+#include <vector>
+
+using namespace llvm;
+
+// Generate names that look like the mangled symbol names found in symbol
+// tables: long, with a shared prefix, and differing only towards the end.
+static std::vector<std::string> getSymbolNames(size_t NumNames,
+                                               const std::string &Prefix) {
+  std::vector<std::string> Names;
+  Names.reserve(NumNames);
+  uint32_t State = 0xcafebabe;
+  for (size_t I = 0; I < NumNames; ++I) {
+    State ^= State << 13;
+    State ^= State >> 17;
+    State ^= State << 5;
+    std::string Base = std::to_string(State);
+    Names.push_back(Prefix + std::to_string(Base.size()) + Base +
+                    "ERKNS_9StringRefE");
+  }
+  return Names;
+}
+
+static void BM_StringMapInsert(benchmark::State &State) {
+  std::vector<std::string> Names =
+      getSymbolNames(State.range(0), "_ZN4llvm3lld3elf");
+  for (auto _ : State) {
+    StringMap<unsigned> Map;
+    for (const std::string &Name : Names)
+      Map.try_emplace(Name, 0);
+    benchmark::DoNotOptimize(Map.size());
+  }
+  State.SetItemsProcessed(State.iterations() * Names.size());
+}
+
+// A linker sees most names several times, once per object file that
+// references them, and only the first occurrence creates an entry.
+static void BM_StringMapInsertDuplicates(benchmark::State &State) {
+  std::vector<std::string> Names =
+      getSymbolNames(State.range(0) / 4, "_ZN4llvm3lld3elf");
+  for (auto _ : State) {
+    StringMap<unsigned> Map;
+    for (unsigned Round = 0; Round < 4; ++Round)
+      for (const std::string &Name : Names)
+        ++Map.try_emplace(Name, 0).first->second;
+    benchmark::DoNotOptimize(Map.size());
+  }
+  State.SetItemsProcessed(State.iterations() * Names.size() * 4);
+}
+
+static void BM_StringMapLookupHit(benchmark::State &State) {
+  std::vector<std::string> Names =
+      getSymbolNames(State.range(0), "_ZN4llvm3lld3elf");
+  StringMap<unsigned> Map;
+  for (const std::string &Name : Names)
+    Map.try_emplace(Name, 0);
+  for (auto _ : State)
+    for (const std::string &Name : Names)
+      benchmark::DoNotOptimize(Map.find(Name));
+  State.SetItemsProcessed(State.iterations() * Names.size());
+}
+
+// Misses only differ from the keys in their prefix. The stored full hash
+// should reject almost all of them without comparing the keys.
+static void BM_StringMapLookupMiss(benchmark::State &State) {
+  StringMap<unsigned> Map;
+  for (const std::string &Name :
+       getSymbolNames(State.range(0), "_ZN4llvm3lld3elf"))
+    Map.try_emplace(Name, 0);
+  std::vector<std::string> Misses =
+      getSymbolNames(State.range(0), "_ZN4llvm3lld4wasm");
+  for (auto _ : State)
+    for (const std::string &Name : Misses)
+      benchmark::DoNotOptimize(Map.find(Name));
+  State.SetItemsProcessed(State.iterations() * Misses.size());
+}
+
+BENCHMARK(BM_StringMapInsert)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK(BM_StringMapInsertDuplicates)
+    ->Arg(1 << 10)
+    ->Arg(1 << 16)
+    ->Arg(1 << 20);
+BENCHMARK(BM_StringMapLookupHit)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK(BM_StringMapLookupMiss)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20);
+
+BENCHMARK_MAIN();
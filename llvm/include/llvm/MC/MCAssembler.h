@@ -113,9 +113,9 @@ private:
   bool fragmentNeedsRelaxation(const MCRelaxableFragment *IF) const;
 
   void layoutSection(MCSection &Sec);
-  /// Perform one layout iteration and return true if any offsets
-  /// were adjusted.
-  bool relaxOnce();
+  /// Perform one layout iteration over \p Sections and return true if any
+  /// offsets were adjusted.
+  bool relaxOnce(ArrayRef<MCSection *> Sections);
 
   /// Perform relaxation on a single fragment.
   bool relaxFragment(MCFragment &F);
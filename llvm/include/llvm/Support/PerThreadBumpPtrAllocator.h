@@ -114,6 +114,54 @@ protected:
 
 using PerThreadBumpPtrAllocator = PerThreadAllocator<BumpPtrAllocator>;
 
+/// PerThreadSpecificBumpPtrAllocator is the per-thread counterpart of
+/// SpecificBumpPtrAllocator: it allocates objects of a single type T from a
+/// SpecificBumpPtrAllocator owned by the current thread, and calls the
+/// destructors of all of them when it is destroyed or DestroyAll() is called.
+/// The same restrictions as for PerThreadAllocator apply.
+template <typename T> class PerThreadSpecificBumpPtrAllocator {
+public:
+  PerThreadSpecificBumpPtrAllocator()
+      : NumOfAllocators(parallel::getThreadCount()),
+        Allocators(std::make_unique<SpecificBumpPtrAllocator<T>[]>(
+            NumOfAllocators)) {}
+
+  /// \defgroup Methods which could be called asynchronously:
+  ///
+  /// @{
+
+  /// Allocate space for an array of \a Num objects without constructing them.
+  T *Allocate(size_t Num = 1) {
+    return getThreadLocalAllocator().Allocate(Num);
+  }
+
+  /// Return allocator corresponding to the current thread.
+  SpecificBumpPtrAllocator<T> &getThreadLocalAllocator() {
+    assert(getThreadIndex() < NumOfAllocators);
+    return Allocators[getThreadIndex()];
+  }
+
+  // Return number of used allocators.
+  size_t getNumberOfAllocators() const { return NumOfAllocators; }
+  /// @}
+
+  /// \defgroup Methods which could not be called asynchronously:
+  ///
+  /// @{
+
+  /// Call the destructor of each allocated object and free all memory
+  /// allocated so far.
+  void DestroyAll() {
+    for (size_t Idx = 0; Idx < getNumberOfAllocators(); Idx++)
+      Allocators[Idx].DestroyAll();
+  }
+  /// @}
+
+protected:
+  size_t NumOfAllocators;
+  std::unique_ptr<SpecificBumpPtrAllocator<T>[]> Allocators;
+};
+
 } // end namespace parallel
 } // end namespace llvm
 
@@ -969,25 +969,24 @@ static void createCandidatesFromSuffixTree(
   if (StringLen < 2)
     return;
 
+  if (RS.StartIndices.empty())
+    return;
+
+  // Check that this subsequence does not contain an illegal instruction. Every
+  // instance of \p RS maps to the same sequence of integers, so it is enough
+  // to check the first one. If we have an illegal instruction, we should not
+  // create IRSimilarityCandidates for this subsequence.
+  ArrayRef<unsigned> Keys =
+      ArrayRef(IntegerMapping).slice(RS.StartIndices.front(), StringLen);
+  if (llvm::any_of(Keys, [&Mapper](unsigned Key) {
+        return Key > Mapper.IllegalInstrNumber;
+      }))
+    return;
+
   // Create an IRSimilarityCandidate for instance of this subsequence \p RS.
   for (const unsigned &StartIdx : RS.StartIndices) {
     unsigned EndIdx = StartIdx + StringLen - 1;
 
-    // Check that this subsequence does not contain an illegal instruction.
-    bool ContainsIllegal = false;
-    for (unsigned CurrIdx = StartIdx; CurrIdx <= EndIdx; CurrIdx++) {
-      unsigned Key = IntegerMapping[CurrIdx];
-      if (Key > Mapper.IllegalInstrNumber) {
-        ContainsIllegal = true;
-        break;
-      }
-    }
-
-    // If we have an illegal instruction, we should not create an
-    // IRSimilarityCandidate for this region.
-    if (ContainsIllegal)
-      continue;
-
     // We are getting iterators to the instructions in this region of code
     // by advancing the start and end indices from the start of the
     // InstrList.
@@ -1273,12 +1273,22 @@ static bool compareWithScalarFnName(const VecDesc &LHS, StringRef S) {
   return LHS.getScalarFnName() < S;
 }
 
-void TargetLibraryInfoImpl::addVectorizableFunctions(ArrayRef<VecDesc> Fns) {
-  llvm::append_range(VectorDescs, Fns);
-  llvm::sort(VectorDescs, compareByScalarFnName);
+/// Append \p Fns to the sorted \p Descs, keeping it sorted by \p Compare.
+/// Only the new entries are sorted; they are then merged with the existing
+/// ones, so adding several tables does not re-sort the earlier ones.
+template <typename CompareT>
+static void appendSorted(std::vector<VecDesc> &Descs, ArrayRef<VecDesc> Fns,
+                         CompareT Compare) {
+  size_t NumOld = Descs.size();
+  llvm::append_range(Descs, Fns);
+  llvm::sort(Descs.begin() + NumOld, Descs.end(), Compare);
+  std::inplace_merge(Descs.begin(), Descs.begin() + NumOld, Descs.end(),
+                     Compare);
+}
 
-  llvm::append_range(ScalarDescs, Fns);
-  llvm::sort(ScalarDescs, compareByVectorFnName);
+void TargetLibraryInfoImpl::addVectorizableFunctions(ArrayRef<VecDesc> Fns) {
+  appendSorted(VectorDescs, Fns, compareByScalarFnName);
+  appendSorted(ScalarDescs, Fns, compareByVectorFnName);
 }
 
 static const VecDesc VecFuncs_Accelerate[] = {
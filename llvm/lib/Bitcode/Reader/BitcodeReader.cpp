@@ -7013,18 +7013,17 @@ Error BitcodeReader::materialize(GlobalValue *GV) {
   if (DISubprogram *SP = MDLoader->lookupSubprogramForFunction(F))
     F->setSubprogram(SP);
 
-  // Check if the TBAA Metadata are valid, otherwise we will need to strip them.
-  if (!MDLoader->isStrippingTBAA()) {
-    for (auto &I : instructions(F)) {
+  for (auto &I : instructions(F)) {
+    // Check if the TBAA Metadata are valid, otherwise we will need to strip
+    // them.
+    if (!MDLoader->isStrippingTBAA()) {
       MDNode *TBAA = I.getMetadata(LLVMContext::MD_tbaa);
-      if (!TBAA || TBAAVerifyHelper.visitTBAAMetadata(I, TBAA))
-        continue;
-      MDLoader->setStripTBAA(true);
-      stripTBAA(F->getParent());
+      if (TBAA && !TBAAVerifyHelper.visitTBAAMetadata(I, TBAA)) {
+        MDLoader->setStripTBAA(true);
+        stripTBAA(F->getParent());
+      }
     }
-  }
 
-  for (auto &I : instructions(F)) {
     // "Upgrade" older incorrect branch weights by dropping them.
     if (auto *MD = I.getMetadata(LLVMContext::MD_prof)) {
       if (MD->getOperand(0) != nullptr && isa<MDString>(MD->getOperand(0))) {
@@ -7055,15 +7054,21 @@ Error BitcodeReader::materialize(GlobalValue *GV) {
       }
     }
 
-    // Remove incompatible attributes on function calls.
+    // Remove incompatible attributes on function calls. Most calls carry no
+    // attributes at all, so skip computing the incompatible set for those.
     if (auto *CI = dyn_cast<CallBase>(&I)) {
-      CI->removeRetAttrs(AttributeFuncs::typeIncompatible(
-          CI->getFunctionType()->getReturnType(), CI->getRetAttributes()));
-
-      for (unsigned ArgNo = 0; ArgNo < CI->arg_size(); ++ArgNo)
-        CI->removeParamAttrs(ArgNo, AttributeFuncs::typeIncompatible(
-                                        CI->getArgOperand(ArgNo)->getType(),
-                                        CI->getParamAttributes(ArgNo)));
+      AttributeSet RetAttrs = CI->getRetAttributes();
+      if (RetAttrs.hasAttributes())
+        CI->removeRetAttrs(AttributeFuncs::typeIncompatible(
+            CI->getFunctionType()->getReturnType(), RetAttrs));
+
+      for (unsigned ArgNo = 0; ArgNo < CI->arg_size(); ++ArgNo) {
+        AttributeSet ParamAttrs = CI->getParamAttributes(ArgNo);
+        if (ParamAttrs.hasAttributes())
+          CI->removeParamAttrs(ArgNo, AttributeFuncs::typeIncompatible(
+                                          CI->getArgOperand(ArgNo)->getType(),
+                                          ParamAttrs));
+      }
     }
   }
 
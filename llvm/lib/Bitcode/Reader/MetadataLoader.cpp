@@ -353,10 +353,12 @@ public:
   void flush(BitcodeReaderMetadataList &MetadataList);
 
   /// Return the list of temporaries nodes in the queue, these need to be
-  /// loaded before we can flush the queue.
-  void getTemporaries(BitcodeReaderMetadataList &MetadataList,
-                      DenseSet<unsigned> &Temporaries) {
-    for (auto &PH : PHs) {
+  /// loaded before we can flush the queue. Only the placeholders from index
+  /// \p Begin on are looked at. Returns the number of placeholders in the
+  /// queue.
+  size_t getTemporaries(BitcodeReaderMetadataList &MetadataList,
+                        DenseSet<unsigned> &Temporaries, size_t Begin) {
+    for (auto &PH : llvm::drop_begin(PHs, Begin)) {
       auto ID = PH.getID();
       auto *MD = MetadataList.lookup(ID);
       if (!MD) {
@@ -367,6 +369,7 @@ public:
       if (N && N->isTemporary())
         Temporaries.insert(ID);
     }
+    return PHs.size();
   }
 };
 
@@ -1188,9 +1191,14 @@ void MetadataLoader::MetadataLoaderImpl::lazyLoadOneMetadata(
 void MetadataLoader::MetadataLoaderImpl::resolveForwardRefsAndPlaceholders(
     PlaceholderQueue &Placeholders) {
   DenseSet<unsigned> Temporaries;
+  // The placeholders before this index have been loaded by a previous
+  // iteration and do not need to be looked at again. Without this, the
+  // queue is rescanned from the start every time loading adds placeholders.
+  size_t NumChecked = 0;
   while (true) {
     // Populate Temporaries with the placeholders that haven't been loaded yet.
-    Placeholders.getTemporaries(MetadataList, Temporaries);
+    NumChecked =
+        Placeholders.getTemporaries(MetadataList, Temporaries, NumChecked);
 
     // If we don't have any temporary, or FwdReference, we're done!
     if (Temporaries.empty() && !MetadataList.hasFwdRefs())
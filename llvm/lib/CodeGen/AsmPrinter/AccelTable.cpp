@@ -31,12 +31,23 @@
 using namespace llvm;
 
 void AccelTableBase::computeBucketCount() {
-  SmallVector<uint32_t, 0> Uniques;
-  Uniques.reserve(Entries.size());
-  for (const auto &E : Entries)
-    Uniques.push_back(E.second.HashValue);
-  llvm::sort(Uniques);
-  UniqueHashCount = llvm::unique(Uniques) - Uniques.begin();
+  // Sort the entries by hash value, breaking ties by insertion order. Packing
+  // both into one integer keeps the sort free of pointer chasing.
+  SmallVector<uint64_t, 0> Keys;
+  Keys.reserve(Entries.size());
+  for (const auto &[Idx, E] : enumerate(Entries))
+    Keys.push_back(uint64_t(E.second.HashValue) << 32 | Idx);
+  llvm::sort(Keys);
+
+  Hashes.clear();
+  Hashes.reserve(Keys.size());
+  UniqueHashCount = 0;
+  for (uint64_t Key : Keys) {
+    HashData *HD = &Entries.begin()[Key & 0xffffffff].second;
+    if (Hashes.empty() || Hashes.back()->HashValue != HD->HashValue)
+      ++UniqueHashCount;
+    Hashes.push_back(HD);
+  }
   BucketCount = dwarf::getDebugNamesBucketCount(UniqueHashCount);
 }
 
@@ -49,28 +60,22 @@ void AccelTableBase::finalize(AsmPrinter *Asm, StringRef Prefix) {
                         return *A < *B;
                       });
     E.second.Values.erase(llvm::unique(E.second.Values), E.second.Values.end());
+    // Add a temporary symbol so the data can be referenced when emitting the
+    // offsets.
+    E.second.Sym = Asm->createTempSymbol(Prefix);
   }
 
   // Figure out how many buckets we need, then compute the bucket contents and
   // the final ordering. The hashes and offsets can be emitted by walking these
-  // data structures. We add temporary symbols to the data so they can be
-  // referenced when emitting the offsets.
+  // data structures.
   computeBucketCount();
 
-  // Compute bucket contents and final ordering.
+  // Compute bucket contents and final ordering. Distributing the entries in
+  // hash order leaves each bucket sorted by hash value, so that hash
+  // collisions end up together, with ties in insertion order.
   Buckets.resize(BucketCount);
-  for (auto &E : Entries) {
-    uint32_t Bucket = E.second.HashValue % BucketCount;
-    Buckets[Bucket].push_back(&E.second);
-    E.second.Sym = Asm->createTempSymbol(Prefix);
-  }
-
-  // Sort the contents of the buckets by hash value so that hash collisions end
-  // up together. Stable sort makes testing easier and doesn't cost much more.
-  for (auto &Bucket : Buckets)
-    llvm::stable_sort(Bucket, [](HashData *LHS, HashData *RHS) {
-      return LHS->HashValue < RHS->HashValue;
-    });
+  for (HashData *HD : Hashes)
+    Buckets[HD->HashValue % BucketCount].push_back(HD);
 }
 
 namespace {
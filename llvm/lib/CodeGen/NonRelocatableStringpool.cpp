@@ -7,7 +7,6 @@
 //===----------------------------------------------------------------------===//
 
 #include "llvm/CodeGen/NonRelocatableStringpool.h"
-#include "llvm/ADT/STLExtras.h"
 
 namespace llvm {
 
@@ -32,15 +31,12 @@ StringRef NonRelocatableStringpool::internString(StringRef S) {
 
 std::vector<DwarfStringPoolEntryRef>
 NonRelocatableStringpool::getEntriesForEmission() const {
-  std::vector<DwarfStringPoolEntryRef> Result;
-  Result.reserve(Strings.size());
+  // Indexed entries are numbered densely in insertion order, so each one can
+  // be placed directly at its index instead of sorting.
+  std::vector<DwarfStringPoolEntryRef> Result(NumEntries);
   for (const auto &E : Strings)
     if (E.getValue().isIndexed())
-      Result.emplace_back(E);
-  llvm::sort(Result, [](const DwarfStringPoolEntryRef A,
-                        const DwarfStringPoolEntryRef B) {
-    return A.getIndex() < B.getIndex();
-  });
+      Result[E.getValue().Index] = E;
   return Result;
 }
 
@@ -119,6 +119,13 @@ static cl::opt<unsigned long> GrowRegionComplexityBudget(
              "limit its budget and bail out once we reach the limit."),
     cl::init(10000), cl::Hidden);
 
+static cl::opt<unsigned> RegionSplitBudget(
+    "greedy-region-split-budget",
+    cl::desc("Maximum number of region splits tried per function. Once it is "
+             "used up, global live ranges are only split around blocks, which "
+             "bounds the allocation time of huge functions (0 = no limit)."),
+    cl::init(0), cl::Hidden);
+
 static cl::opt<bool> GreedyRegClassPriorityTrumpsGlobalness(
     "greedy-regclass-priority-trumps-globalness",
     cl::desc("Change the greedy register allocator's live range priority "
@@ -1957,11 +1964,27 @@ MCRegister RAGreedy::trySplit(const LiveInterval &VirtReg,
 
   // First try to split around a region spanning multiple blocks. RS_Split2
   // ranges already made dubious progress with region splitting, so they go
-  // straight to single block splitting.
+  // straight to single block splitting. So do all ranges once the region
+  // split budget of the function is used up.
   if (ExtraInfo->getStage(VirtReg) < RS_Split2) {
-    MCRegister PhysReg = tryRegionSplit(VirtReg, Order, NewVRegs);
-    if (PhysReg || !NewVRegs.empty())
-      return PhysReg;
+    if (!RegionSplitBudget || NumRegionSplits < RegionSplitBudget) {
+      ++NumRegionSplits;
+      MCRegister PhysReg = tryRegionSplit(VirtReg, Order, NewVRegs);
+      if (PhysReg || !NewVRegs.empty())
+        return PhysReg;
+    } else if (!ReportedRegionSplitBudget) {
+      ReportedRegionSplitBudget = true;
+      ORE->emit([&]() {
+        DebugLoc Loc;
+        if (auto *SP = MF->getFunction().getSubprogram())
+          Loc = DILocation::get(SP->getContext(), SP->getLine(), 1, SP);
+        return MachineOptimizationRemarkMissed(DEBUG_TYPE, "RegionSplitBudget",
+                                               Loc, &MF->front())
+               << "region split budget of "
+               << ore::NV("RegionSplitBudget", RegionSplitBudget.getValue())
+               << " used up, fell back to block splitting";
+      });
+    }
   }
 
   // Then isolate blocks.
@@ -2891,6 +2914,8 @@ bool RAGreedy::run(MachineFunction &mf) {
   IntfCache.init(MF, Matrix->getLiveUnions(), Indexes, LIS, TRI);
   GlobalCand.resize(32);  // This will grow as needed.
   SetOfBrokenHints.clear();
+  NumRegionSplits = 0;
+  ReportedRegionSplitBudget = false;
 
   allocatePhysRegs();
   tryHintsRecoloring();
@@ -210,6 +210,14 @@ private:
 
   uint8_t CutOffInfo = CutOffStage::CO_None;
 
+  /// Number of region splits tried so far in the current function, checked
+  /// against -greedy-region-split-budget.
+  unsigned NumRegionSplits = 0;
+
+  /// Whether a region split has been skipped because the budget was used up,
+  /// which is reported once per function.
+  bool ReportedRegionSplitBudget = false;
+
 #ifndef NDEBUG
   static const char *const StageName[];
 #endif
@@ -153,6 +153,12 @@ static cl::opt<bool> DisableCombines("combiner-disabled", cl::Hidden,
                                      cl::init(false),
                                      cl::desc("Disable the DAG combiner"));
 
+static cl::opt<unsigned> CombinerVisitBudget(
+    "combiner-visit-budget", cl::Hidden, cl::init(0),
+    cl::desc("Maximum number of nodes the DAG combiner tries to combine in "
+             "one run (0 = no limit). Once it is used up, nodes are only "
+             "deleted if dead and re-legalized as needed"));
+
 namespace {
 
   class DAGCombiner {
@@ -1769,6 +1775,9 @@ void DAGCombiner::Run(CombineLevel AtLevel) {
   // changes of the root.
   HandleSDNode Dummy(DAG.getRoot());
 
+  // Number of nodes we tried to combine, checked against CombinerVisitBudget.
+  unsigned NumVisited = 0;
+
   // While we have a valid worklist entry node, try to combine it.
   while (SDNode *N = getNextWorklistEntry()) {
     // If N has no uses, it is dead.  Make sure to revisit all N's operands once
@@ -1792,6 +1801,12 @@ void DAGCombiner::Run(CombineLevel AtLevel) {
         continue;
     }
 
+    // Keep draining the worklist once the budget is used up: after
+    // legalization, the nodes on it still have to be re-legalized above.
+    if (CombinerVisitBudget && NumVisited >= CombinerVisitBudget)
+      continue;
+    ++NumVisited;
+
     LLVM_DEBUG(dbgs() << "\nCombining: "; N->dump(&DAG));
 
     // Add any operands of the new node which have not yet been combined to the
@@ -74,6 +74,12 @@ static cl::opt<bool>
     DumpThinCGSCCs("dump-thin-cg-sccs", cl::init(false), cl::Hidden,
                    cl::desc("Dump the SCCs in the ThinLTO index's callgraph"));
 
+static cl::opt<bool> ThinLTOOrderBySummaryCost(
+    "thinlto-order-by-summary-cost", cl::init(false), cl::Hidden,
+    cl::desc("Schedule parallel ThinLTO backends by the instruction count of "
+             "the functions each module defines and imports, instead of by "
+             "bitcode size"));
+
 extern cl::opt<bool> CodeGenDataThinLTOTwoRounds;
 
 extern cl::opt<bool> ForceImportAll;
@@ -1879,6 +1885,26 @@ ThinBackend lto::createWriteIndexesThinBackend(
   return ThinBackend(Func, Parallelism);
 }
 
+/// Estimate the cost of the ThinLTO backend for a module as the number of IR
+/// instructions in the functions it defines plus those it imports as
+/// definitions, according to the combined summary. Unlike the bitcode size,
+/// this accounts for the work added by importing.
+static uint64_t
+estimateBackendCost(const ModuleSummaryIndex &Index,
+                    const GVSummaryMapTy &DefinedGVSummaries,
+                    const FunctionImporter::ImportMapTy &ImportList) {
+  uint64_t Cost = 0;
+  for (const auto &[GUID, S] : DefinedGVSummaries)
+    if (auto *FS = dyn_cast<FunctionSummary>(S))
+      Cost += FS->instCount();
+  for (const auto &[FromModule, GUID, Kind] : ImportList)
+    if (Kind == GlobalValueSummary::Definition)
+      if (auto *FS = dyn_cast_or_null<FunctionSummary>(
+              Index.findSummaryInModule(GUID, FromModule)))
+        Cost += FS->instCount();
+  return Cost;
+}
+
 Error LTO::runThinLTO(AddStreamFn AddStream, FileCache Cache,
                       const DenseSet<GlobalValue::GUID> &GUIDPreservedSymbols) {
   LLVM_DEBUG(dbgs() << "Running ThinLTO\n");
@@ -2073,11 +2099,27 @@ Error LTO::runThinLTO(AddStreamFn AddStream, FileCache Cache,
       // improve parallelism, and avoid starving the thread pool near the end.
       // This saves about 15 sec on a 36-core machine while link `clang.exe`
       // (out of 100 sec).
-      std::vector<BitcodeModule *> ModulesVec;
-      ModulesVec.reserve(ModuleMap.size());
-      for (auto &Mod : ModuleMap)
-        ModulesVec.push_back(&Mod.second);
-      for (int I : generateModulesOrdering(ModulesVec))
+      std::vector<int> ModulesOrdering;
+      if (ThinLTOOrderBySummaryCost) {
+        std::vector<uint64_t> Costs;
+        Costs.reserve(ModuleMap.size());
+        for (auto &Mod : ModuleMap)
+          Costs.push_back(estimateBackendCost(
+              ThinLTO.CombinedIndex, ModuleToDefinedGVSummaries[Mod.first],
+              ImportLists[Mod.first]));
+        auto Seq = llvm::seq<int>(0, ModuleMap.size());
+        ModulesOrdering.assign(Seq.begin(), Seq.end());
+        llvm::stable_sort(ModulesOrdering, [&](int LeftIndex, int RightIndex) {
+          return Costs[LeftIndex] > Costs[RightIndex];
+        });
+      } else {
+        std::vector<BitcodeModule *> ModulesVec;
+        ModulesVec.reserve(ModuleMap.size());
+        for (auto &Mod : ModuleMap)
+          ModulesVec.push_back(&Mod.second);
+        ModulesOrdering = generateModulesOrdering(ModulesVec);
+      }
+      for (int I : ModulesOrdering)
         if (Error E = ProcessOneModule(I))
           return E;
     }
@@ -810,6 +810,23 @@ void MCAssembler::writeSectionData(raw_ostream &OS,
          OS.tell() - Start == getSectionAddressSize(*Sec));
 }
 
+static bool isRelaxableKind(const MCFragment &F) {
+  switch (F.getKind()) {
+  default:
+    return false;
+  case MCFragment::FT_Relaxable:
+  case MCFragment::FT_Dwarf:
+  case MCFragment::FT_DwarfFrame:
+  case MCFragment::FT_LEB:
+  case MCFragment::FT_BoundaryAlign:
+  case MCFragment::FT_CVInlineLines:
+  case MCFragment::FT_CVDefRange:
+  case MCFragment::FT_Fill:
+  case MCFragment::FT_PseudoProbe:
+    return true;
+  }
+}
+
 void MCAssembler::layout() {
   assert(getBackendPtr() && "Expected assembler backend");
   DEBUG_WITH_TYPE("mc-dump", {
@@ -840,11 +857,20 @@ void MCAssembler::layout() {
     }
   }
 
-  // Layout until everything fits.
+  // Layout until everything fits. Only sections containing a fragment that
+  // relaxFragment() handles can change size; the others are laid out once.
   this->HasLayout = true;
-  for (MCSection &Sec : *this)
+  SmallVector<MCSection *, 0> RelaxableSections;
+  for (MCSection &Sec : *this) {
     layoutSection(Sec);
-  while (relaxOnce())
+    for (MCFragment &F : Sec) {
+      if (isRelaxableKind(F)) {
+        RelaxableSections.push_back(&Sec);
+        break;
+      }
+    }
+  }
+  while (relaxOnce(RelaxableSections))
     if (getContext().hadError())
       return;
 
@@ -1229,7 +1255,7 @@ void MCAssembler::layoutSection(MCSection &Sec) {
   }
 }
 
-bool MCAssembler::relaxOnce() {
+bool MCAssembler::relaxOnce(ArrayRef<MCSection *> Sections) {
   ++stats::RelaxationSteps;
   PendingErrors.clear();
 
@@ -1237,7 +1263,8 @@ bool MCAssembler::relaxOnce() {
   // another. If any fragment has changed size, we have to re-layout (and
   // as a result possibly further relax) all sections.
   bool ChangedAny = false;
-  for (MCSection &Sec : *this) {
+  for (MCSection *SecPtr : Sections) {
+    MCSection &Sec = *SecPtr;
     // Assume each iteration finalizes at least one extra fragment. If the
     // layout does not converge after N+1 iterations, bail out.
     auto MaxIter = Sec.curFragList()->Tail->getLayoutOrder() + 1;
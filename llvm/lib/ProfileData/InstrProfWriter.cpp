@@ -390,9 +390,17 @@ void InstrProfWriter::addTemporalProfileTraces(
 
 void InstrProfWriter::mergeRecordsFromWriter(InstrProfWriter &&IPW,
                                              function_ref<void(Error)> Warn) {
-  for (auto &I : IPW.FunctionData)
+  for (auto &I : IPW.FunctionData) {
+    // Records of a function this writer has not seen yet were already
+    // normalized by IPW's addRecord(), so they can be taken over as a whole.
+    auto [It, Inserted] = FunctionData.try_emplace(I.getKey());
+    if (Inserted) {
+      It->second = std::move(I.getValue());
+      continue;
+    }
     for (auto &Func : I.getValue())
       addRecord(I.getKey(), Func.first, std::move(Func.second), 1, Warn);
+  }
 
   BinaryIds.reserve(BinaryIds.size() + IPW.BinaryIds.size());
   for (auto &I : IPW.BinaryIds)
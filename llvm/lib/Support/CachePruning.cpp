@@ -11,6 +11,7 @@
 //===----------------------------------------------------------------------===//
 
 #include "llvm/Support/CachePruning.h"
+#include "llvm/ADT/STLExtras.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/Support/Debug.h"
 #include "llvm/Support/Errc.h"
@@ -22,8 +23,8 @@
 
 #define DEBUG_TYPE "cache-pruning"
 
-#include <set>
 #include <system_error>
+#include <vector>
 
 using namespace llvm;
 
@@ -33,8 +34,9 @@ struct FileInfo {
   uint64_t Size;
   std::string Path;
 
-  /// Used to determine which files to prune first. Also used to determine
-  /// set membership, so must take into account all fields.
+  /// Used to determine which files to prune first. Takes into account all
+  /// fields so that the order does not depend on the directory iteration
+  /// order.
   bool operator<(const FileInfo &Other) const {
     return std::tie(Time, Other.Size, Path) <
            std::tie(Other.Time, Size, Other.Path);
@@ -203,7 +205,9 @@ bool llvm::pruneCache(StringRef Path, CachePruningPolicy Policy,
 
   // Keep track of files to delete to get below the size limit.
   // Order by time of last use so that recently used files are preserved.
-  std::set<FileInfo> FileInfos;
+  // The files are collected first and sorted once, which is a lot cheaper
+  // than keeping a set ordered for caches with many entries.
+  std::vector<FileInfo> FileInfos;
   uint64_t TotalSize = 0;
 
   // Walk the entire directory cache, looking for unused files.
@@ -242,8 +246,9 @@ bool llvm::pruneCache(StringRef Path, CachePruningPolicy Policy,
 
     // Leave it here for now, but add it to the list of size-based pruning.
     TotalSize += StatusOrErr->getSize();
-    FileInfos.insert({FileAccessTime, StatusOrErr->getSize(), File->path()});
+    FileInfos.push_back({FileAccessTime, StatusOrErr->getSize(), File->path()});
   }
+  llvm::sort(FileInfos);
 
   auto FileInfo = FileInfos.begin();
   size_t NumFiles = FileInfos.size();
@@ -21,15 +21,36 @@
 
 using namespace llvm;
 
+// The decimal representations of 0 to 99, so that digits can be produced two
+// at a time.
+static constexpr char TwoDigits[] = "00010203040506070809"
+                                    "10111213141516171819"
+                                    "20212223242526272829"
+                                    "30313233343536373839"
+                                    "40414243444546474849"
+                                    "50515253545556575859"
+                                    "60616263646566676869"
+                                    "70717273747576777879"
+                                    "80818283848586878889"
+                                    "90919293949596979899";
+
 template<typename T, std::size_t N>
 static int format_to_buffer(T Value, char (&Buffer)[N]) {
   char *EndPtr = std::end(Buffer);
   char *CurPtr = EndPtr;
 
-  do {
-    *--CurPtr = '0' + char(Value % 10);
-    Value /= 10;
-  } while (Value);
+  while (Value >= 100) {
+    const char *Digits = TwoDigits + 2 * (Value % 100);
+    Value /= 100;
+    *--CurPtr = Digits[1];
+    *--CurPtr = Digits[0];
+  }
+  if (Value >= 10) {
+    *--CurPtr = TwoDigits[2 * Value + 1];
+    *--CurPtr = TwoDigits[2 * Value];
+  } else {
+    *--CurPtr = '0' + char(Value);
+  }
   return EndPtr - CurPtr;
 }
 
@@ -59,19 +80,30 @@ static void write_unsigned_impl(raw_ostream &S, T N, size_t MinDigits,
   char NumberBuffer[128];
   size_t Len = format_to_buffer(N, NumberBuffer);
 
-  if (IsNegative)
-    S << '-';
-
-  if (Len < MinDigits && Style != IntegerStyle::Number) {
-    for (size_t I = Len; I < MinDigits; ++I)
-      S << '0';
-  }
-
   if (Style == IntegerStyle::Number) {
+    if (IsNegative)
+      S << '-';
     writeWithCommas(S, ArrayRef<char>(std::end(NumberBuffer) - Len, Len));
-  } else {
-    S.write(std::end(NumberBuffer) - Len, Len);
+    return;
+  }
+
+  // Put the sign and the zero padding into the buffer as well, so that the
+  // common case is a single write to the stream.
+  size_t Padding = MinDigits > Len ? MinDigits - Len : 0;
+  if (Len + Padding + IsNegative <= std::size(NumberBuffer)) {
+    char *CurPtr = std::end(NumberBuffer) - Len - Padding;
+    ::memset(CurPtr, '0', Padding);
+    if (IsNegative)
+      *--CurPtr = '-';
+    S.write(CurPtr, std::end(NumberBuffer) - CurPtr);
+    return;
   }
+
+  if (IsNegative)
+    S << '-';
+  for (size_t I = 0; I < Padding; ++I)
+    S << '0';
+  S.write(std::end(NumberBuffer) - Len, Len);
 }
 
 template <typename T>
@@ -147,14 +179,14 @@ void llvm::write_hex(raw_ostream &S, uint64_t N, HexPrintStyle Style,
       std::max(static_cast<unsigned>(W), std::max(1u, Nibbles) + PrefixChars);
 
   char NumberBuffer[kMaxWidth];
-  ::memset(NumberBuffer, '0', std::size(NumberBuffer));
+  ::memset(NumberBuffer, '0', NumChars);
   if (Prefix)
     NumberBuffer[1] = 'x';
+  const char *HexDigits = Upper ? "0123456789ABCDEF" : "0123456789abcdef";
   char *EndPtr = NumberBuffer + NumChars;
   char *CurPtr = EndPtr;
   while (N) {
-    unsigned char x = static_cast<unsigned char>(N) % 16;
-    *--CurPtr = hexdigit(x, !Upper);
+    *--CurPtr = HexDigits[N % 16];
     N /= 16;
   }
 
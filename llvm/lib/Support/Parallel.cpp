@@ -12,7 +12,9 @@
 #include "llvm/Support/Threading.h"
 
 #include <atomic>
+#include <deque>
 #include <future>
+#include <memory>
 #include <thread>
 #include <vector>
 
@@ -44,12 +46,22 @@ public:
   static Executor *getDefaultExecutor();
 };
 
-/// An implementation of an Executor that runs closures on a thread pool
-///   in filo order.
+/// An implementation of an Executor that runs closures on a thread pool.
+///
+/// Every worker owns a queue. Closures added from a worker thread go to that
+/// worker's queue, and closures added from other threads are distributed
+/// round-robin. A worker runs the closures of its own queue in filo order and,
+/// once it is empty, steals the oldest closure from the other queues. Keeping
+/// the queues separate avoids having every add() and every dequeue contend on
+/// a single mutex when many small tasks are spawned: the shared mutex is only
+/// taken to sleep and, by add(), to wake a worker when one is sleeping.
 class ThreadPoolExecutor : public Executor {
 public:
   explicit ThreadPoolExecutor(ThreadPoolStrategy S) {
     ThreadCount = S.compute_thread_count();
+    Queues.reserve(ThreadCount);
+    for (unsigned I = 0; I < ThreadCount; ++I)
+      Queues.push_back(std::make_unique<WorkQueue>());
     // Spawn all but one of the threads in another thread as spawning threads
     // can take a while.
     Threads.reserve(ThreadCount);
@@ -98,33 +110,82 @@ public:
   };
 
   void add(std::function<void()> F) override {
+    unsigned Index = threadIndex < ThreadCount
+                         ? threadIndex
+                         : NextQueue.fetch_add(1, std::memory_order_relaxed) %
+                               ThreadCount;
+    WorkQueue &Q = *Queues[Index];
     {
-      std::lock_guard<std::mutex> Lock(Mutex);
-      WorkStack.push_back(std::move(F));
+      std::lock_guard<std::mutex> Lock(Q.Mutex);
+      Q.Tasks.push_back(std::move(F));
+      Pending.fetch_add(1);
     }
+    // A worker increments Sleepers before it checks Pending under the mutex,
+    // and Pending was incremented above before Sleepers is read here, so
+    // either the worker sees the new closure or we see the worker. Taking the
+    // mutex makes sure that a worker that has not started waiting yet cannot
+    // miss the notification.
+    if (Sleepers.load() == 0)
+      return;
+    { std::lock_guard<std::mutex> Lock(Mutex); }
     Cond.notify_one();
   }
 
   size_t getThreadCount() const override { return ThreadCount; }
 
 private:
+  struct WorkQueue {
+    std::mutex Mutex;
+    std::deque<std::function<void()>> Tasks;
+  };
+
+  // Pops the newest closure of this worker's queue, or steals the oldest one
+  // from another worker.
+  bool pop(unsigned ThreadID, std::function<void()> &Task) {
+    for (unsigned I = 0; I < ThreadCount; ++I) {
+      WorkQueue &Q = *Queues[(ThreadID + I) % ThreadCount];
+      std::lock_guard<std::mutex> Lock(Q.Mutex);
+      if (Q.Tasks.empty())
+        continue;
+      if (I == 0) {
+        Task = std::move(Q.Tasks.back());
+        Q.Tasks.pop_back();
+      } else {
+        Task = std::move(Q.Tasks.front());
+        Q.Tasks.pop_front();
+      }
+      Pending.fetch_sub(1);
+      return true;
+    }
+    return false;
+  }
+
   void work(ThreadPoolStrategy S, unsigned ThreadID) {
     threadIndex = ThreadID;
     S.apply_thread_strategy(ThreadID);
+    std::function<void()> Task;
     while (true) {
+      if (pop(ThreadID, Task)) {
+        Task();
+        Task = nullptr;
+        continue;
+      }
       std::unique_lock<std::mutex> Lock(Mutex);
-      Cond.wait(Lock, [&] { return Stop || !WorkStack.empty(); });
+      Sleepers.fetch_add(1);
+      Cond.wait(Lock, [&] { return Stop || Pending.load() != 0; });
+      Sleepers.fetch_sub(1);
       if (Stop)
         break;
-      auto Task = std::move(WorkStack.back());
-      WorkStack.pop_back();
-      Lock.unlock();
-      Task();
     }
   }
 
   std::atomic<bool> Stop{false};
-  std::vector<std::function<void()>> WorkStack;
+  // The number of closures in all queues.
+  std::atomic<size_t> Pending{0};
+  // The number of workers that are waiting, or about to wait, on Cond.
+  std::atomic<unsigned> Sleepers{0};
+  std::atomic<unsigned> NextQueue{0};
+  std::vector<std::unique_ptr<WorkQueue>> Queues;
   std::mutex Mutex;
   std::condition_variable Cond;
   std::promise<void> ThreadsCreated;
@@ -212,24 +273,34 @@ void llvm::parallelFor(size_t Begin, size_t End,
                        llvm::function_ref<void(size_t)> Fn) {
 #if LLVM_ENABLE_THREADS
   if (parallel::strategy.ThreadsRequested != 1) {
-    auto NumItems = End - Begin;
-    // Limit the number of tasks to MaxTasksPerGroup to limit job scheduling
-    // overhead on large inputs.
-    auto TaskSize = NumItems / parallel::detail::MaxTasksPerGroup;
-    if (TaskSize == 0)
-      TaskSize = 1;
+    // Rather than splitting the range into tasks of a fixed size up front,
+    // start one task per thread and let each of them repeatedly claim a chunk
+    // of the remaining items. Chunks start large and shrink as the range is
+    // used up, so that a thread that got stuck on expensive items does not
+    // leave the others idle at the end of the loop. Chunks never get smaller
+    // than NumItems / MaxTasksPerGroup to limit the contention on Next for
+    // cheap iterations.
+    size_t NumItems = End - Begin;
+    size_t NumTasks = std::min(parallel::getThreadCount(), NumItems);
+    size_t MinChunkSize =
+        std::max<size_t>(NumItems / parallel::detail::MaxTasksPerGroup, 1);
+    std::atomic<size_t> Next{Begin};
 
     parallel::TaskGroup TG;
-    for (; Begin + TaskSize < End; Begin += TaskSize) {
-      TG.spawn([=, &Fn] {
-        for (size_t I = Begin, E = Begin + TaskSize; I != E; ++I)
-          Fn(I);
-      });
-    }
-    if (Begin != End) {
-      TG.spawn([=, &Fn] {
-        for (size_t I = Begin; I != End; ++I)
-          Fn(I);
+    for (size_t I = 0; I != NumTasks; ++I) {
+      TG.spawn([=, &Next, &Fn] {
+        size_t ChunkBegin = Next.load(std::memory_order_relaxed);
+        while (ChunkBegin < End) {
+          size_t ChunkSize =
+              std::max((End - ChunkBegin) / (2 * NumTasks), MinChunkSize);
+          size_t ChunkEnd = std::min(ChunkBegin + ChunkSize, End);
+          if (!Next.compare_exchange_weak(ChunkBegin, ChunkEnd,
+                                          std::memory_order_relaxed))
+            continue;
+          for (size_t J = ChunkBegin; J != ChunkEnd; ++J)
+            Fn(J);
+          ChunkBegin = Next.load(std::memory_order_relaxed);
+        }
       });
     }
     return;
@@ -73,7 +73,7 @@ using NameAndCountAndDurationType =
 struct llvm::TimeTraceProfilerEntry {
   const TimePointType Start;
   TimePointType End;
-  const std::string Name;
+  std::string Name;
   TimeTraceMetadata Metadata;
 
   const TimeTraceEventType EventType = TimeTraceEventType::CompleteEvent;
@@ -177,19 +177,14 @@ struct llvm::TimeTraceProfiler {
     // Calculate duration at full precision for overall counts.
     DurationType Duration = E.End - E.Start;
 
-    const auto *Iter =
-        llvm::find_if(Stack, [&](const std::unique_ptr<InProgressEntry> &Val) {
+    // Entries are almost always ended in the reverse order of their
+    // beginning, so search from the top of the stack.
+    auto RIter = llvm::find_if(
+        llvm::reverse(Stack), [&](const std::unique_ptr<InProgressEntry> &Val) {
           return &Val->Event == &E;
         });
-    assert(Iter != Stack.end() && "Event not in the Stack");
-
-    // Only include sections longer or equal to TimeTraceGranularity msec.
-    if (duration_cast<microseconds>(Duration).count() >= TimeTraceGranularity) {
-      Entries.emplace_back(E);
-      for (auto &IE : Iter->get()->InstantEvents) {
-        Entries.emplace_back(IE);
-      }
-    }
+    assert(RIter != Stack.rend() && "Event not in the Stack");
+    auto Iter = std::next(RIter).base();
 
     // Track total time taken by each "name", but only the topmost levels of
     // them; e.g. if there's a template instantiation that instantiates other
@@ -205,6 +200,16 @@ struct llvm::TimeTraceProfiler {
       CountAndTotal.second += Duration;
     };
 
+    // Only include sections longer or equal to TimeTraceGranularity msec.
+    // The entry is removed from the stack below, so its contents can be moved
+    // rather than copied.
+    if (duration_cast<microseconds>(Duration).count() >= TimeTraceGranularity) {
+      Entries.emplace_back(std::move(E));
+      for (auto &IE : Iter->get()->InstantEvents) {
+        Entries.emplace_back(std::move(IE));
+      }
+    }
+
     Stack.erase(Iter);
   }
 
@@ -425,6 +425,10 @@ raw_ostream &raw_ostream::operator<<(const FormattedBytes &FB) {
       alignTo(FB.NumPerLine, FB.ByteGroupSize) / FB.ByteGroupSize;
   unsigned BlockCharWidth = FB.NumPerLine * 2 + NumByteGroups - 1;
 
+  // Each line is formatted into a buffer first, so that dumping large blocks
+  // does not go through the stream for every single character.
+  const char *HexDigits = FB.Upper ? "0123456789ABCDEF" : "0123456789abcdef";
+  SmallString<128> LineBuffer;
   while (!Bytes.empty()) {
     indent(FB.IndentLevel);
 
@@ -436,31 +440,29 @@ raw_ostream &raw_ostream::operator<<(const FormattedBytes &FB) {
 
     auto Line = Bytes.take_front(FB.NumPerLine);
 
-    size_t CharsPrinted = 0;
     // Print the hex bytes for this line in groups
-    for (size_t I = 0; I < Line.size(); ++I, CharsPrinted += 2) {
-      if (I && (I % FB.ByteGroupSize) == 0) {
-        ++CharsPrinted;
-        *this << " ";
-      }
-      llvm::write_hex(*this, Line[I], HPS, 2);
+    LineBuffer.clear();
+    for (size_t I = 0; I < Line.size(); ++I) {
+      if (I && (I % FB.ByteGroupSize) == 0)
+        LineBuffer.push_back(' ');
+      LineBuffer.push_back(HexDigits[Line[I] >> 4]);
+      LineBuffer.push_back(HexDigits[Line[I] & 0xF]);
     }
+    *this << LineBuffer;
+    size_t CharsPrinted = LineBuffer.size();
 
     if (FB.ASCII) {
       // Print any spaces needed for any bytes that we didn't print on this
       // line so that the ASCII bytes are correctly aligned.
       assert(BlockCharWidth >= CharsPrinted);
       indent(BlockCharWidth - CharsPrinted + 2);
-      *this << "|";
 
       // Print the ASCII char values for each byte on this line
-      for (uint8_t Byte : Line) {
-        if (isPrint(Byte))
-          *this << static_cast<char>(Byte);
-        else
-          *this << '.';
-      }
-      *this << '|';
+      LineBuffer.assign(1, '|');
+      for (uint8_t Byte : Line)
+        LineBuffer.push_back(isPrint(Byte) ? static_cast<char>(Byte) : '.');
+      LineBuffer.push_back('|');
+      *this << LineBuffer;
     }
 
     Bytes = Bytes.drop_front(Line.size());
@@ -61,6 +61,9 @@
 
 STATISTIC(NumColdRegionsFound, "Number of cold regions found.");
 STATISTIC(NumColdRegionsOutlined, "Number of cold regions outlined.");
+STATISTIC(NumColdInstsOutlined,
+          "Number of instructions moved out of their function into cold "
+          "functions.");
 
 using namespace llvm;
 
@@ -418,6 +421,7 @@ Function *HotColdSplitting::extractColdRegion(
     User *U = *OutF->user_begin();
     CallInst *CI = cast<CallInst>(U);
     NumColdRegionsOutlined++;
+    NumColdInstsOutlined += OutF->getInstructionCount();
     if (TTI.useColdCCForColdCall(*OutF)) {
       OutF->setCallingConv(CallingConv::Cold);
       CI->setCallingConv(CallingConv::Cold);
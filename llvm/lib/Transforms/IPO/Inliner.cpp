@@ -67,6 +67,8 @@ using namespace llvm;
 
 STATISTIC(NumInlined, "Number of functions inlined");
 STATISTIC(NumDeleted, "Number of functions deleted because all callers found");
+STATISTIC(NumOverBudget,
+          "Number of call sites not inlined because a budget was exhausted");
 
 static cl::opt<int> IntraSCCCostMultiplier(
     "intra-scc-cost-multiplier", cl::init(2), cl::Hidden,
@@ -80,6 +82,18 @@ static cl::opt<int> IntraSCCCostMultiplier(
         "multiplied by intra-scc-cost-multiplier). This is to prevent tons of "
         "inlining through a child SCC which can cause terrible compile times"));
 
+static cl::opt<unsigned> CallerSizeBudget(
+    "inliner-caller-size-budget", cl::init(0), cl::Hidden,
+    cl::desc("Stop inlining into a caller once it has grown to more than this "
+             "many instructions (0 = no limit). This bounds the compile time "
+             "of later function passes on callers that inlining cascades "
+             "would otherwise blow up"));
+
+static cl::opt<unsigned> SCCInlineBudget(
+    "inliner-scc-inline-budget", cl::init(0), cl::Hidden,
+    cl::desc("Maximum number of call sites inlined in one run of the inliner "
+             "over an SCC (0 = no limit)"));
+
 /// A flag for test, so we can print the content of the advisor when running it
 /// as part of the default (e.g. -O3) pipeline.
 static cl::opt<bool> KeepAdvisorForPrinting("keep-inline-advisor-for-printing",
@@ -303,6 +317,9 @@ PreservedAnalyses InlinerPass::run(LazyCallGraph::SCC &InitialC,
   // be deleted as a batch after inlining.
   SmallVector<Function *, 4> DeadFunctionsInComdats;
 
+  // Number of call sites inlined so far, checked against SCCInlineBudget.
+  unsigned NumInlinedInSCC = 0;
+
   // Loop forward over all of the calls. Note that we cannot cache the size as
   // inlining can introduce new calls that need to be processed.
   for (int I = 0; I < (int)Calls.size(); ++I) {
@@ -323,6 +340,10 @@ PreservedAnalyses InlinerPass::run(LazyCallGraph::SCC &InitialC,
       return FAM.getResult<AssumptionAnalysis>(F);
     };
 
+    // Only count the instructions of the caller when a size budget is set, as
+    // this walks all of its blocks.
+    unsigned CallerSize = CallerSizeBudget ? F.getInstructionCount() : 0;
+
     // Now process as many calls as we have within this caller in the sequence.
     // We bail out as soon as the caller has to change so we can update the
     // call graph and prepare the context of that new caller.
@@ -358,6 +379,32 @@ PreservedAnalyses InlinerPass::run(LazyCallGraph::SCC &InitialC,
         continue;
       }
 
+      // Stop inlining once a compile-time budget is used up. This is checked
+      // before asking the advisor so that call sites over the budget don't
+      // pay for the cost analysis. The call sites are not marked noinline, so
+      // they may still be inlined when the budget allows it again, e.g. after
+      // the caller has been simplified. always_inline call sites are neither
+      // limited by nor counted against the budgets.
+      bool IsMandatory =
+          OnlyMandatory || CB->hasFnAttr(Attribute::AlwaysInline);
+      if (!IsMandatory && CallerSizeBudget && CallerSize > CallerSizeBudget) {
+        LLVM_DEBUG(dbgs() << "Skipping inlining due to caller size budget: "
+                          << F.getName() << " -> " << Callee.getName()
+                          << "\n");
+        setInlineRemark(*CB, "caller size budget");
+        ++NumOverBudget;
+        continue;
+      }
+      if (!IsMandatory && SCCInlineBudget &&
+          NumInlinedInSCC >= SCCInlineBudget) {
+        LLVM_DEBUG(dbgs() << "Skipping inlining due to SCC inline budget: "
+                          << F.getName() << " -> " << Callee.getName()
+                          << "\n");
+        setInlineRemark(*CB, "SCC inline budget");
+        ++NumOverBudget;
+        continue;
+      }
+
       std::unique_ptr<InlineAdvice> Advice =
           Advisor.getAdvice(*CB, OnlyMandatory);
 
@@ -397,6 +444,10 @@ PreservedAnalyses InlinerPass::run(LazyCallGraph::SCC &InitialC,
       DidInline = true;
       InlinedCallees.insert(&Callee);
       ++NumInlined;
+      if (!IsMandatory)
+        ++NumInlinedInSCC;
+      if (CallerSizeBudget)
+        CallerSize = F.getInstructionCount();
 
       LLVM_DEBUG(dbgs() << "    Size after inlining: "
                         << F.getInstructionCount() << "\n");
@@ -173,8 +173,7 @@ class FunctionNode {
   stable_hash Hash;
 
 public:
-  // Note the hash is recalculated potentially multiple times, but it is cheap.
-  FunctionNode(Function *F) : F(F), Hash(StructuralHash(*F)) {}
+  FunctionNode(Function *F, stable_hash Hash) : F(F), Hash(Hash) {}
 
   Function *getFunc() const { return F; }
   stable_hash getHash() const { return Hash; }
@@ -236,7 +235,8 @@ private:
 
   /// Insert a ComparableFunction into the FnTree, or merge it away if it's
   /// equal to one that's already present.
-  bool insert(Function *NewFunction);
+  /// \p Hash is the structural hash of \p NewFunction.
+  bool insert(Function *NewFunction, stable_hash Hash);
 
   /// Remove a Function from the FnTree and queue it up for a second sweep of
   /// analysis.
@@ -440,6 +440,8 @@ template <typename FuncContainer> bool MergeFunctions::run(FuncContainer &M) {
   // All functions in the module, ordered by hash. Functions with a unique
   // hash value are easily eliminated.
   std::vector<std::pair<stable_hash, Function *>> HashedFuncs;
+  // Structural hashes of the functions queued in Deferred for the first round.
+  std::vector<stable_hash> InitialHashes;
   for (auto &Func : M) {
     Function *FuncPtr = asPtr(Func);
     if (isEligibleForMerging(*FuncPtr)) {
@@ -456,12 +458,20 @@ template <typename FuncContainer> bool MergeFunctions::run(FuncContainer &M) {
     if ((I != S && std::prev(I)->first == I->first) ||
         (std::next(I) != IE && std::next(I)->first == I->first)) {
       Deferred.push_back(WeakTrackingVH(I->second));
+      InitialHashes.push_back(I->first);
     }
   }
 
   do {
     std::vector<WeakTrackingVH> Worklist;
     Deferred.swap(Worklist);
+    // The structural hash only looks at the CFG and the opcodes, so merging
+    // other functions and redirecting calls does not change it for the
+    // functions that are still to be inserted in the first round; reuse the
+    // hashes computed above instead of hashing each function again. Functions
+    // deferred to later rounds have been modified and are hashed again.
+    std::vector<stable_hash> Hashes;
+    InitialHashes.swap(Hashes);
 
     LLVM_DEBUG(doFunctionalCheck(Worklist));
 
@@ -469,12 +479,13 @@ template <typename FuncContainer> bool MergeFunctions::run(FuncContainer &M) {
     LLVM_DEBUG(dbgs() << "size of worklist: " << Worklist.size() << '\n');
 
     // Insert functions and merge them.
-    for (WeakTrackingVH &I : Worklist) {
+    for (auto [Idx, I] : enumerate(Worklist)) {
       if (!I)
         continue;
       Function *F = cast<Function>(I);
       if (!F->isDeclaration() && !F->hasAvailableExternallyLinkage()) {
-        Changed |= insert(F);
+        Changed |=
+            insert(F, Hashes.empty() ? StructuralHash(*F) : Hashes[Idx]);
       }
     }
     LLVM_DEBUG(dbgs() << "size of FnTree: " << FnTree.size() << '\n');
@@ -1008,9 +1019,9 @@ static bool isFuncOrderCorrect(const Function *F, const Function *G) {
 
 // Insert a ComparableFunction into the FnTree, or merge it away if equal to one
 // that was already inserted.
-bool MergeFunctions::insert(Function *NewFunction) {
+bool MergeFunctions::insert(Function *NewFunction, stable_hash Hash) {
   std::pair<FnTreeType::iterator, bool> Result =
-      FnTree.insert(FunctionNode(NewFunction));
+      FnTree.insert(FunctionNode(NewFunction, Hash));
 
   if (Result.second) {
     assert(FNodesInTree.count(NewFunction) == 0);
@@ -5367,10 +5367,14 @@ bool SROA::splitAlloca(AllocaInst &AI, AllocaSlices &AS) {
     // If a byte boundary is included in any load or store, a slice starting or
     // ending at the boundary is not splittable.
     SmallBitVector SplittableOffset(AllocaSize + 1, true);
-    for (Slice &S : AS)
-      for (unsigned O = S.beginOffset() + 1;
-           O < S.endOffset() && O < AllocaSize; O++)
-        SplittableOffset.reset(O);
+    for (Slice &S : AS) {
+      // Reset the whole range at once; allocas with many wide slices would
+      // otherwise spend a lot of time here clearing one bit at a time.
+      uint64_t Begin = S.beginOffset() + 1;
+      uint64_t End = std::min(S.endOffset(), AllocaSize);
+      if (Begin < End)
+        SplittableOffset.reset(Begin, End);
+    }
 
     for (Slice &S : AS) {
       if (!S.isSplittable())
@@ -164,6 +164,21 @@ TEST(Parallel, ParallelNestedTaskGroup) {
   }
   EXPECT_EQ(Count, 12ul);
 }
+
+TEST(Parallel, SpawnFromWorkers) {
+  // Tasks spawned from worker threads go to the worker's own queue and have
+  // to be picked up by the other workers as well.
+  std::atomic<size_t> Count{0};
+  {
+    parallel::TaskGroup tg;
+    for (size_t I = 0; I < 16; ++I)
+      tg.spawn([&]() {
+        for (size_t J = 0; J < 256; ++J)
+          tg.spawn([&]() { ++Count; });
+      });
+  }
+  EXPECT_EQ(Count, 16ul * 256);
+}
 #endif
 
 #endif
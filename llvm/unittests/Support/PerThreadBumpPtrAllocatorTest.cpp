@@ -9,6 +9,7 @@
 #include "llvm/Support/PerThreadBumpPtrAllocator.h"
 #include "llvm/Support/Parallel.h"
 #include "gtest/gtest.h"
+#include <atomic>
 #include <cstdlib>
 
 using namespace llvm;
@@ -53,4 +54,27 @@ TEST(PerThreadBumpPtrAllocatorTest, ParallelAllocation) {
   EXPECT_EQ(Allocator.getNumberOfAllocators(), parallel::getThreadCount());
 }
 
+TEST(PerThreadBumpPtrAllocatorTest, SpecificDestroyAll) {
+  static std::atomic<size_t> NumDestroyed;
+  struct Counted {
+    ~Counted() { ++NumDestroyed; }
+  };
+
+  static size_t constexpr NumAllocations = 1000;
+  NumDestroyed = 0;
+  {
+    PerThreadSpecificBumpPtrAllocator<Counted> Allocator;
+    parallelFor(0, NumAllocations,
+                [&](size_t Idx) { new (Allocator.Allocate()) Counted(); });
+    EXPECT_EQ(Allocator.getNumberOfAllocators(), parallel::getThreadCount());
+
+    Allocator.DestroyAll();
+    EXPECT_EQ(NumAllocations, NumDestroyed);
+
+    parallelFor(0, NumAllocations,
+                [&](size_t Idx) { new (Allocator.Allocate()) Counted(); });
+  }
+  EXPECT_EQ(2 * NumAllocations, NumDestroyed);
+}
+
 } // anonymous namespace
@@ -366,7 +366,14 @@ extern "C" bool mlirAsyncRuntimeIsGroupError(AsyncGroup *group) {
   return group->numErrors.load() > 0;
 }
 
+// The await functions below check the atomic state before acquiring the lock,
+// so that awaiting an already completed token, value or group never contends
+// with other threads on the mutex. The state only transitions once, and it is
+// written after the payload, so observing a terminal state is sufficient.
+
 extern "C" void mlirAsyncRuntimeAwaitToken(AsyncToken *token) {
+  if (State(token->state).isAvailableOrError())
+    return;
   std::unique_lock<std::mutex> lock(token->mu);
   if (!State(token->state).isAvailableOrError())
     token->cv.wait(
@@ -374,6 +381,8 @@ extern "C" void mlirAsyncRuntimeAwaitToken(AsyncToken *token) {
 }
 
 extern "C" void mlirAsyncRuntimeAwaitValue(AsyncValue *value) {
+  if (State(value->state).isAvailableOrError())
+    return;
   std::unique_lock<std::mutex> lock(value->mu);
   if (!State(value->state).isAvailableOrError())
     value->cv.wait(
@@ -381,6 +390,8 @@ extern "C" void mlirAsyncRuntimeAwaitValue(AsyncValue *value) {
 }
 
 extern "C" void mlirAsyncRuntimeAwaitAllInGroup(AsyncGroup *group) {
+  if (group->pendingTokens == 0)
+    return;
   std::unique_lock<std::mutex> lock(group->mu);
   if (group->pendingTokens != 0)
     group->cv.wait(lock, [group] { return group->pendingTokens == 0; });
@@ -401,6 +412,10 @@ extern "C" void mlirAsyncRuntimeAwaitTokenAndExecute(AsyncToken *token,
                                                      CoroHandle handle,
                                                      CoroResume resume) {
   auto execute = [handle, resume]() { (*resume)(handle); };
+  if (State(token->state).isAvailableOrError()) {
+    execute();
+    return;
+  }
   std::unique_lock<std::mutex> lock(token->mu);
   if (State(token->state).isAvailableOrError()) {
     lock.unlock();
@@ -414,6 +429,10 @@ extern "C" void mlirAsyncRuntimeAwaitValueAndExecute(AsyncValue *value,
                                                      CoroHandle handle,
                                                      CoroResume resume) {
   auto execute = [handle, resume]() { (*resume)(handle); };
+  if (State(value->state).isAvailableOrError()) {
+    execute();
+    return;
+  }
   std::unique_lock<std::mutex> lock(value->mu);
   if (State(value->state).isAvailableOrError()) {
     lock.unlock();
@@ -427,6 +446,10 @@ extern "C" void mlirAsyncRuntimeAwaitAllInGroupAndExecute(AsyncGroup *group,
                                                           CoroHandle handle,
                                                           CoroResume resume) {
   auto execute = [handle, resume]() { (*resume)(handle); };
+  if (group->pendingTokens == 0) {
+    execute();
+    return;
+  }
   std::unique_lock<std::mutex> lock(group->mu);
   if (group->pendingTokens == 0) {
     lock.unlock();
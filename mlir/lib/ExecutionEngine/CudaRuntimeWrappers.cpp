@@ -232,6 +232,33 @@ extern "C" MLIR_CUDA_WRAPPERS_EXPORT void mgpuEventRecord(CUevent event,
   CUDA_REPORT_IF_ERROR(cuEventRecord(event, stream));
 }
 
+#if (CUDA_VERSION >= 11030)
+// Returns true if device allocations should use the stream-ordered allocator.
+// The default memory pool of the device is configured to keep freed memory
+// cached instead of returning it to the driver at every synchronization, so
+// that programs allocating and freeing small buffers per operation do not
+// serialize on cuMemAlloc/cuMemFree. Must be called within a ScopedContext.
+static bool useStreamOrderedAllocator() {
+  static bool isEnabled = [] {
+    CUdevice device = getDefaultCuDevice();
+    int supported = 0;
+    CUDA_REPORT_IF_ERROR(cuDeviceGetAttribute(
+        &supported, CU_DEVICE_ATTRIBUTE_MEMORY_POOLS_SUPPORTED, device));
+    if (!supported)
+      return false;
+    CUmemoryPool pool;
+    CUDA_REPORT_IF_ERROR(cuDeviceGetDefaultMemPool(&pool, device));
+    cuuint64_t threshold = UINT64_MAX;
+    CUDA_REPORT_IF_ERROR(cuMemPoolSetAttribute(
+        pool, CU_MEMPOOL_ATTR_RELEASE_THRESHOLD, &threshold));
+    debug_print("using stream-ordered allocator on device %d\n",
+                defaultDevice);
+    return true;
+  }();
+  return isEnabled;
+}
+#endif
+
 extern "C" MLIR_CUDA_WRAPPERS_EXPORT void *
 mgpuMemAlloc(uint64_t sizeBytes, CUstream stream, bool isHostShared) {
   ScopedContext scopedContext;
@@ -244,12 +271,33 @@ mgpuMemAlloc(uint64_t sizeBytes, CUstream stream, bool isHostShared) {
         cuMemAllocManaged(&ptr, sizeBytes, CU_MEM_ATTACH_GLOBAL));
     return reinterpret_cast<void *>(ptr);
   }
+#if (CUDA_VERSION >= 11030)
+  if (useStreamOrderedAllocator()) {
+    CUDA_REPORT_IF_ERROR(cuMemAllocAsync(&ptr, sizeBytes, stream));
+    return reinterpret_cast<void *>(ptr);
+  }
+#endif
   CUDA_REPORT_IF_ERROR(cuMemAlloc(&ptr, sizeBytes));
   return reinterpret_cast<void *>(ptr);
 }
 
 extern "C" MLIR_CUDA_WRAPPERS_EXPORT void mgpuMemFree(void *ptr,
-                                                      CUstream /*stream*/) {
+                                                      CUstream stream) {
+#if (CUDA_VERSION >= 11030)
+  ScopedContext scopedContext;
+  // Only memory that came from a pool may be released with cuMemFreeAsync;
+  // managed allocations are still freed synchronously. The query fails for
+  // pointers that are not pool allocations, which leaves `pool` unset.
+  CUmemoryPool pool = nullptr;
+  if (ptr)
+    cuPointerGetAttribute(&pool, CU_POINTER_ATTRIBUTE_MEMPOOL_HANDLE,
+                          reinterpret_cast<CUdeviceptr>(ptr));
+  if (pool) {
+    CUDA_REPORT_IF_ERROR(
+        cuMemFreeAsync(reinterpret_cast<CUdeviceptr>(ptr), stream));
+    return;
+  }
+#endif
   CUDA_REPORT_IF_ERROR(cuMemFree(reinterpret_cast<CUdeviceptr>(ptr)));
 }
 
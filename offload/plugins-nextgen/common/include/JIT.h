@@ -64,6 +64,12 @@ private:
   compile(const __tgt_device_image &Image, const std::string &ComputeUnitKind,
           PostProcessingFn PostProcessing);
 
+  /// Return the key under which the image generated from \p Image for \p
+  /// ComputeUnitKind is stored in the on-disk cache, or an empty string if the
+  /// result must not be cached.
+  std::string getCacheKey(const __tgt_device_image &Image,
+                          const std::string &ComputeUnitKind);
+
   /// Create or retrieve the object image file from the file system or via
   /// compilation of the \p Image.
   Expected<std::unique_ptr<MemoryBuffer>>
@@ -112,6 +118,7 @@ private:
       StringEnvar("LIBOMPTARGET_JIT_POST_OPT_IR_MODULE");
   UInt32Envar JITOptLevel = UInt32Envar("LIBOMPTARGET_JIT_OPT_LEVEL", 3);
   BoolEnvar JITSkipOpt = BoolEnvar("LIBOMPTARGET_JIT_SKIP_OPT", false);
+  StringEnvar JITCacheDirectory = StringEnvar("LIBOMPTARGET_JIT_CACHE_DIR");
 };
 
 } // namespace target
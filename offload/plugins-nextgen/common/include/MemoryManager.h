@@ -237,16 +237,19 @@ public:
 
     NodeTy *NodePtr = nullptr;
 
-    // Try to get a node from FreeList
+    // Try to get a node from FreeList. Take the smallest node that fits
+    // instead of requiring an exact size match, but do not hand out nodes of
+    // more than twice the requested size, which is only possible in the last
+    // bucket if the threshold was raised.
     {
       const int B = findBucket(Size);
       FreeListTy &List = FreeLists[B];
 
       NodeTy TempNode(Size, nullptr);
       std::lock_guard<std::mutex> LG(FreeListLocks[B]);
-      const auto Itr = List.find(TempNode);
+      const auto Itr = List.lower_bound(TempNode);
 
-      if (Itr != List.end()) {
+      if (Itr != List.end() && Itr->get().Size / 2 <= Size) {
         NodePtr = &Itr->get();
         List.erase(Itr);
       }
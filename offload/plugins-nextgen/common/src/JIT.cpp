@@ -17,8 +17,10 @@
 #include "omptarget.h"
 
 #include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/StringExtras.h"
 #include "llvm/CodeGen/CommandFlags.h"
 #include "llvm/CodeGen/MachineModuleInfo.h"
+#include "llvm/Config/llvm-config.h"
 #include "llvm/IR/LLVMContext.h"
 #include "llvm/IR/LLVMRemarkStreamer.h"
 #include "llvm/IR/LegacyPassManager.h"
@@ -28,7 +30,9 @@
 #include "llvm/Object/IRObjectFile.h"
 #include "llvm/Passes/OptimizationLevel.h"
 #include "llvm/Passes/PassBuilder.h"
+#include "llvm/Support/Caching.h"
 #include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/SHA1.h"
 #include "llvm/Support/SourceMgr.h"
 #include "llvm/Support/TargetSelect.h"
 #include "llvm/Support/TimeProfiler.h"
@@ -277,6 +281,28 @@ JITEngine::getOrCreateObjFile(const __tgt_device_image &Image, LLVMContext &Ctx,
   return backend(*Mod, ComputeUnitKind, JITOptLevel);
 }
 
+std::string JITEngine::getCacheKey(const __tgt_device_image &Image,
+                                   const std::string &ComputeUnitKind) {
+  if (!JITCacheDirectory.isPresent() || JITCacheDirectory.get().empty())
+    return "";
+
+  // Results that depend on files or dump IR as a side effect are not cached.
+  if (ReplacementObjectFileName.isPresent() ||
+      ReplacementModuleFileName.isPresent() ||
+      PreOptIRModuleFileName.isPresent() || PostOptIRModuleFileName.isPresent())
+    return "";
+
+  SHA1 Hasher;
+  Hasher.update(LLVM_VERSION_STRING);
+  Hasher.update(TT.str());
+  Hasher.update(ComputeUnitKind);
+  Hasher.update(utostr(JITOptLevel.get()));
+  Hasher.update(JITSkipOpt.get() ? "skip-opt" : "opt");
+  Hasher.update(StringRef(reinterpret_cast<const char *>(Image.ImageStart),
+                          utils::getPtrDiff(Image.ImageEnd, Image.ImageStart)));
+  return toHex(Hasher.result());
+}
+
 Expected<const __tgt_device_image *>
 JITEngine::compile(const __tgt_device_image &Image,
                    const std::string &ComputeUnitKind,
@@ -288,15 +314,57 @@ JITEngine::compile(const __tgt_device_image &Image,
   if (__tgt_device_image *JITedImage = CUI.TgtImageMap.lookup(&Image))
     return JITedImage;
 
-  auto ObjMBOrErr = getOrCreateObjFile(Image, CUI.Context, ComputeUnitKind);
-  if (!ObjMBOrErr)
-    return ObjMBOrErr.takeError();
+  // Check if a previous process left the final image in the on-disk cache.
+  // Problems with the cache are not fatal, we just compile the image again.
+  std::unique_ptr<MemoryBuffer> ImageMB;
+  AddStreamFn AddStream;
+  std::string CacheKey = getCacheKey(Image, ComputeUnitKind);
+  if (!CacheKey.empty()) {
+    auto CacheOrErr = localCache(
+        "offload JIT cache", "offload-jit", JITCacheDirectory.get(),
+        [&](unsigned, const Twine &, std::unique_ptr<MemoryBuffer> MB) {
+          if (!ImageMB)
+            ImageMB = std::move(MB);
+        });
+    if (!CacheOrErr) {
+      DP("Failed to open the JIT cache: %s\n",
+         toString(CacheOrErr.takeError()).c_str());
+    } else if (auto AddStreamOrErr =
+                   (*CacheOrErr)(/*Task=*/0, CacheKey, ComputeUnitKind)) {
+      AddStream = std::move(*AddStreamOrErr);
+    } else {
+      DP("Failed to look up the JIT cache: %s\n",
+         toString(AddStreamOrErr.takeError()).c_str());
+    }
+  }
 
-  auto ImageMBOrErr = PostProcessing(std::move(*ObjMBOrErr));
-  if (!ImageMBOrErr)
-    return ImageMBOrErr.takeError();
+  if (ImageMB) {
+    DP("Found the JIT image for %s in the cache\n", ComputeUnitKind.c_str());
+  } else {
+    auto ObjMBOrErr = getOrCreateObjFile(Image, CUI.Context, ComputeUnitKind);
+    if (!ObjMBOrErr)
+      return ObjMBOrErr.takeError();
+
+    auto ImageMBOrErr = PostProcessing(std::move(*ObjMBOrErr));
+    if (!ImageMBOrErr)
+      return ImageMBOrErr.takeError();
+    ImageMB = std::move(*ImageMBOrErr);
+
+    // Store the image for later processes. AddStream is only set on a miss.
+    if (AddStream) {
+      auto StreamOrErr = AddStream(/*Task=*/0, ComputeUnitKind);
+      Error E = StreamOrErr.takeError();
+      if (!E) {
+        *(*StreamOrErr)->OS << ImageMB->getBuffer();
+        E = (*StreamOrErr)->commit();
+      }
+      if (E)
+        DP("Failed to write the JIT cache: %s\n",
+           toString(std::move(E)).c_str());
+    }
+  }
 
-  CUI.JITImages.push_back(std::move(*ImageMBOrErr));
+  CUI.JITImages.push_back(std::move(ImageMB));
   __tgt_device_image *&JITedImage = CUI.TgtImageMap[&Image];
   JITedImage = new __tgt_device_image();
   *JITedImage = Image;